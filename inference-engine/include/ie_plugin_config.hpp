@@ -201,6 +201,30 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metrics to get the numbers of the inferences of the CPU executable network which found the graph of their
+ * input shapes in the shape cache and which compiled a new one. See PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPE_CACHE_HITS, uint64_t);
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPE_CACHE_MISSES, uint64_t);
+
+/**
+ * @brief Metrics to get the execution time statistics of every node of the CPU executable network as JSON or CSV
+ * (semicolon separated) text: the number of executions, min, average, 50th, 90th, 99th percentiles and max time
+ * in microseconds, and the number of executions, average and max time per thread which executed the node.
+ * The statistics are merged over the graphs of all the streams. See PluginConfigParams::KEY_CPU_PERF_COUNT_HISTOGRAMS
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_PERF_COUNT_HISTOGRAMS_JSON, std::string);
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_PERF_COUNT_HISTOGRAMS_CSV, std::string);
+
+/**
+ * @brief Metrics to get the numbers of the JIT kernels of the CPU plugin nodes taken from the process wide kernel cache
+ * and generated anew, and the number of the kernels kept by the cache. See PluginConfigParams::KEY_CPU_KERNEL_CACHE_CAPACITY
+ */
+DECLARE_METRIC_KEY(CPU_KERNEL_CACHE_HITS, uint64_t);
+DECLARE_METRIC_KEY(CPU_KERNEL_CACHE_MISSES, uint64_t);
+DECLARE_METRIC_KEY(CPU_KERNEL_CACHE_SIZE, uint64_t);
+
 }  // namespace Metrics
 
 /**
@@ -268,6 +292,70 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief The name for setting dataflow execution of the CPU graph.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::NO (default, nodes of a stream's graph are executed one by one in topological order)
+ * PluginConfigParams::YES (independent nodes, e.g. branches of inception-like blocks, are executed
+ * concurrently within the threads of the stream)
+ *
+ * The option is implemented only for the TBB as a threading option, otherwise it is ignored
+ */
+DECLARE_CONFIG_KEY(CPU_DATAFLOW_EXECUTION);
+
+/**
+ * @brief The name for setting the size of the CPU shape cache.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with non-negative integer values:
+ * 0 (default) disables the cache, the input blobs must have the shapes of the network.
+ * A positive value allows the input blobs of any shapes the network can be reshaped to. The graphs compiled for such shapes
+ * are kept by every stream of the executable network, the value is the number of graphs per stream, the least recently used
+ * graph is evicted first. The graph of a new shape is compiled by the inference which meets it, the graphs of the other
+ * streams are compiled in background. The output blobs which don't match the shapes of the results are reallocated by the
+ * inference, so InferRequest::GetBlob() has to be called again after the inference of new shapes.
+ * The networks with variable states and the dynamic batch are not supported, the networks imported from the blob
+ * of the transformed network can't be reshaped, so the value is ignored for them.
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_CACHE_SIZE);
+
+/**
+ * @brief The name for setting the collection of the node execution time histograms by the CPU plugin.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::NO (default) - only the average time of the nodes is reported by the performance counters
+ * PluginConfigParams::YES - every execution time of the node is counted in its histogram with the nanosecond resolution,
+ *   so the tail latency of the nodes is available via the Metrics::METRIC_CPU_PERF_COUNT_HISTOGRAMS_JSON and
+ *   Metrics::METRIC_CPU_PERF_COUNT_HISTOGRAMS_CSV metrics of the executable network.
+ *   The option has effect only if PluginConfigParams::KEY_PERF_COUNT is PluginConfigParams::YES
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_HISTOGRAMS);
+
+/**
+ * @brief The name for setting the pooled allocation of the CPU memory.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::NO (default) - the graph workspaces and the blobs of the infer requests are allocated from the heap
+ * PluginConfigParams::YES - they are allocated from the process wide pools, which keep the freed blocks for reuse.
+ *   The large blocks are backed by the transparent huge pages and are touched by the stream which builds the graph,
+ *   so its workspace is placed on the NUMA node of the stream
+ * PluginConfigParams::CPU_MEMORY_POOL_HUGE_PAGES - the same, the large blocks are allocated from the reserved huge pages
+ *   (see /proc/sys/vm/nr_hugepages), the transparent huge pages are used if there are no free ones
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_POOL);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_POOL_HUGE_PAGES);
+
+/**
+ * @brief The name for setting the capacity of the CPU kernel cache.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with non-negative integer values.
+ * The JIT kernels of the CPU plugin nodes are kept by the process wide cache, so the nodes of the same parameters
+ * in all the streams and all the networks share the generated code. The value is the number of the kernels kept
+ * (1024 by default), the least recently used kernel is evicted first, 0 disables the cache.
+ * The cache is shared by all the networks, so the last value set is used
+ */
+DECLARE_CONFIG_KEY(CPU_KERNEL_CACHE_CAPACITY);
+
 /**
  * @brief The name for setting performance counters option.
  *
@@ -381,6 +469,26 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key defines how Core::ReadNetwork brings IR weights (.bin file) into memory.
+ *
+ * - NO (default) - the weights file is read into a newly allocated buffer
+ * - YES - the weights file is memory mapped and Constants point directly into the mapping.
+ *   Several processes which read the same model share its physical pages; pages written
+ *   by a process are privately copied
+ * - READ_ONLY - the weights file is mapped read-only, an in-place modification of weights data
+ *   is an access violation
+ *
+ * The weights file must not be modified while a network read from it is alive.
+ * The key is applicable only to Core::SetConfig without a device name:
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(YES)}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(MMAP_WEIGHTS);
+DECLARE_CONFIG_VALUE(READ_ONLY);
+
 }  // namespace PluginConfigParams
 
 /**
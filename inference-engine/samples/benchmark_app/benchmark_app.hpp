@@ -40,6 +40,15 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for open-loop arrival rate
+static const char rate_message[] = "Optional. Enables open-loop load generation for the async API: inference requests arrive at the "
+                                   "specified rate (requests per second) regardless of the completion of previous ones. "
+                                   "The latency is measured from the arrival, so it includes waiting for an idle infer request.";
+
+/// @brief message for open-loop arrivals distribution
+static const char arrival_message[] = "Optional. Distribution of the request arrivals in the open-loop mode: "
+                                      "\"poisson\" (default) for exponentially distributed intervals or \"constant\" for fixed intervals.";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -62,6 +71,11 @@ static const char enforce_bf16_message[] = "Optional. By default floating point
                                            "                                  'true'  - enable  bfloat16 regardless of platform support\n"
                                            "                                  'false' - disable bfloat16 regardless of platform support";
 
+/// @brief message for dataflow execution of the CPU graph
+static const char dataflow_message[] = "Optional. Execute independent nodes of the network concurrently within a CPU stream "
+                                       "(CPU only, requires TBB threading). The synchronous latency is also measured with the "
+                                       "network loaded for the default sequential execution and the speedup is reported.";
+
 /// @brief message for user library argument
 static const char custom_cpu_library_message[] = "Required for CPU custom layers. Absolute path to a shared library with the kernels "
                                                  "implementations.";
@@ -105,6 +119,11 @@ static const char progress_message[] = "Optional. Show progress bar (can affect
 // @brief message for performance counters option
 static const char pc_message[] = "Optional. Report performance counters.";
 
+// @brief message for node execution time histograms option
+static const char pc_histograms_message[] = "Optional. Collect the execution time histograms of the network nodes (CPU only). "
+                                            "Implies the performance counters collection. The percentiles of the nodes are reported "
+                                            "with -pc and stored to the statistics report folder with -report_type.";
+
 #ifdef USE_OPENCV
 // @brief message for load config option
 static const char load_config_message[] = "Optional. Path to XML/YAML/JSON file to load custom IE parameters."
@@ -179,6 +198,12 @@ DEFINE_uint32(niter, 0, iterations_count_message);
 /// @brief Time to execute topology in seconds
 DEFINE_uint32(t, 0, execution_time_message);
 
+/// @brief Open-loop arrival rate of the inference requests per second
+DEFINE_double(rate, 0.0, rate_message);
+
+/// @brief Distribution of the open-loop arrivals
+DEFINE_string(arrival, "poisson", arrival_message);
+
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
@@ -192,6 +217,9 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
+/// @brief Enables dataflow execution of the CPU graph
+DEFINE_bool(dataflow, false, dataflow_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint32(b, 0, batch_size_message);
@@ -217,6 +245,9 @@ DEFINE_bool(progress, false, progress_message);
 /// @brief Define flag for showing performance counters <br>
 DEFINE_bool(pc, false, pc_message);
 
+/// @brief Define flag for collecting node execution time histograms <br>
+DEFINE_bool(pc_histograms, false, pc_histograms_message);
+
 #ifdef USE_OPENCV
 /// @brief Define flag for loading configuration file <br>
 DEFINE_string(load_config, "", load_config_message);
@@ -273,6 +304,8 @@ static void showUsage() {
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << rate_message << std::endl;
+    std::cout << "    -arrival \"<distribution>\" " << arrival_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
@@ -282,12 +315,14 @@ static void showUsage() {
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
     std::cout << "    -enforcebf16=<true/false>     " << enforce_bf16_message << std::endl;
+    std::cout << "    -dataflow=<true/false>    " << dataflow_message << std::endl;
     std::cout << "    -pin \"YES\"/\"HYBRID_AWARE\"/\"NO\"/\"NUMA\"   " << infer_threads_pinning_message << std::endl;
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
+    std::cout << "    -pc_histograms            " << pc_histograms_message << std::endl;
 #ifdef USE_OPENCV
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
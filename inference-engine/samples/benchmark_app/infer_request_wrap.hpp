@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 
+#include "latency_histogram.hpp"
 #include "statistics_report.hpp"
 
 typedef std::chrono::high_resolution_clock Time;
@@ -39,6 +40,13 @@ public:
     }
 
     void startAsync() {
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request which was scheduled to start at scheduledTime,
+    /// so the latency includes the time the request waited to be started
+    void startAsync(Time::time_point scheduledTime) {
+        _scheduledTime = scheduledTime;
         _startTime = Time::now();
         _request.StartAsync();
     }
@@ -49,6 +57,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _scheduledTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
         _callbackQueue(_id, getExecutionTimeInMilliseconds());
@@ -63,12 +72,25 @@ public:
     }
 
     double getExecutionTimeInMilliseconds() const {
-        auto execTime = std::chrono::duration_cast<ns>(_endTime - _startTime);
+        auto execTime = std::chrono::duration_cast<ns>(_endTime - _scheduledTime);
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    Time::time_point getScheduledTime() const {
+        return _scheduledTime;
+    }
+
+    Time::time_point getStartTime() const {
+        return _startTime;
+    }
+
+    Time::time_point getEndTime() const {
+        return _endTime;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _scheduledTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -77,7 +99,17 @@ private:
 
 class InferRequestsQueue final {
 public:
-    InferRequestsQueue(InferenceEngine::ExecutableNetwork& net, size_t nireq) {
+    /// @brief Timestamps of a completed inference request
+    struct Timestamps {
+        size_t id;
+        Time::time_point scheduled;
+        Time::time_point started;
+        Time::time_point completed;
+    };
+
+    /// @param collectTimestamps records the timestamps of the completed requests, only the statistics report uses them
+    InferRequestsQueue(InferenceEngine::ExecutableNetwork& net, size_t nireq, bool collectTimestamps)
+        : _collectTimestamps(collectTimestamps) {
         for (size_t id = 0; id < nireq; id++) {
             requests.push_back(
                 std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::putIdleRequest, this, std::placeholders::_1, std::placeholders::_2)));
@@ -98,6 +130,8 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _latencyHistogram = LatencyHistogram();
+        _timestamps.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -107,6 +141,11 @@ public:
     void putIdleRequest(size_t id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _latencyHistogram.record(latency);
+        if (_collectTimestamps) {
+            const auto& request = requests.at(id);
+            _timestamps.push_back({id, request->getScheduledTime(), request->getStartTime(), request->getEndTime()});
+        }
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -134,6 +173,14 @@ public:
         return _latencies;
     }
 
+    const LatencyHistogram& getLatencyHistogram() const {
+        return _latencyHistogram;
+    }
+
+    const std::vector<Timestamps>& getTimestamps() const {
+        return _timestamps;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -143,4 +190,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    LatencyHistogram _latencyHistogram;
+    bool _collectTimestamps;
+    std::vector<Timestamps> _timestamps;
 };
@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/// @brief Latency histogram with HDR (high dynamic range) layout: values up to 2048 us are counted exactly,
+/// each next power-of-two range is divided into 1024 linear sub-buckets, so any percentile is reported
+/// with relative error below 0.1% using a fixed amount of memory regardless of the number of samples.
+class LatencyHistogram {
+public:
+    LatencyHistogram(): _counts(subBucketCount + (maxExponent - subBucketMagnitude) * subBucketHalfCount, 0) {}
+
+    /// @brief Adds latency value in milliseconds
+    void record(double latencyMs) {
+        const auto value = static_cast<uint64_t>(std::llround(std::max(0.0, latencyMs) * 1000.0));
+        _counts[index(value)]++;
+        _count++;
+        _sum += latencyMs;
+        _min = std::min(_min, latencyMs);
+        _max = std::max(_max, latencyMs);
+    }
+
+    uint64_t count() const {
+        return _count;
+    }
+
+    double min() const {
+        return _count ? _min : 0.0;
+    }
+
+    double max() const {
+        return _count ? _max : 0.0;
+    }
+
+    double average() const {
+        return _count ? _sum / _count : 0.0;
+    }
+
+    /// @brief Returns the latency in milliseconds which is not exceeded by the given percent of values
+    double percentile(double percent) const {
+        if (_count == 0)
+            return 0.0;
+        const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percent / 100.0 * _count)));
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < _counts.size(); i++) {
+            accumulated += _counts[i];
+            if (accumulated >= rank) {
+                return std::min(_max, highestEquivalentValue(i) / 1000.0);
+            }
+        }
+        return _max;
+    }
+
+private:
+    static constexpr int subBucketMagnitude = 11;
+    static constexpr uint64_t subBucketCount = uint64_t(1) << subBucketMagnitude;
+    static constexpr uint64_t subBucketHalfCount = subBucketCount / 2;
+    // values above 2^40 us (~12 days) are saturated
+    static constexpr int maxExponent = 40;
+
+    size_t index(uint64_t value) const {
+        if (value < subBucketCount)
+            return static_cast<size_t>(value);
+        value = std::min<uint64_t>(value, (1ull << maxExponent) - 1);
+        int exponent = 0;
+        while ((value >> (exponent + 1)) != 0)
+            exponent++;
+        const int shift = exponent - (subBucketMagnitude - 1);
+        return static_cast<size_t>(subBucketCount + (exponent - subBucketMagnitude) * subBucketHalfCount + ((value >> shift) - subBucketHalfCount));
+    }
+
+    uint64_t highestEquivalentValue(size_t index) const {
+        if (index < subBucketCount)
+            return index;
+        const auto offset = index - subBucketCount;
+        const int shift = static_cast<int>(offset / subBucketHalfCount) + 1;
+        const auto lowest = (subBucketHalfCount + offset % subBucketHalfCount) << shift;
+        return lowest + (1ull << shift) - 1;
+    }
+
+    std::vector<uint64_t> _counts;
+    uint64_t _count = 0;
+    double _sum = 0.0;
+    double _min = std::numeric_limits<double>::max();
+    double _max = 0.0;
+};
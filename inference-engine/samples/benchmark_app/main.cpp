@@ -9,10 +9,12 @@
 #include <inference_engine.hpp>
 #include <map>
 #include <memory>
+#include <random>
 #include <samples/args_helper.hpp>
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <vpu/vpu_plugin_config.hpp>
@@ -56,6 +58,16 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_rate < 0.0) {
+        throw std::logic_error("Incorrect -rate option value. The arrival rate should be positive.");
+    }
+    if (FLAGS_rate > 0.0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop load generation (-rate option) is supported for the async API only.");
+    }
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "constant") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `poisson` or `constant` value.");
+    }
+
     if (!FLAGS_report_type.empty() && FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
                           " report types are supported (invalid -report_type option value)";
@@ -107,6 +119,22 @@ T getMedianValue(const std::vector<T>& vec) {
                                        : (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
 }
 
+/**
+ * @brief Median latency of the synchronous inferences of a single infer request of the network
+ */
+static double getSyncLatency(ExecutableNetwork& exeNetwork, const std::vector<std::string>& inputFiles, size_t batchSize,
+                             benchmark_app::InputsInfo& app_inputs_info, size_t iterations) {
+    InferRequestsQueue inferRequestsQueue(exeNetwork, 1, false);
+    fillBlobs(inputFiles, batchSize, app_inputs_info, inferRequestsQueue.requests);
+    // warming up
+    inferRequestsQueue.getIdleRequest()->infer();
+    inferRequestsQueue.resetTimes();
+    for (size_t i = 0; i < iterations; i++) {
+        inferRequestsQueue.getIdleRequest()->infer();
+    }
+    return getMedianValue<double>(inferRequestsQueue.getLatencies());
+}
+
 /**
  * @brief The entry point of the benchmark application
  */
@@ -114,6 +142,7 @@ int main(int argc, char* argv[]) {
     std::shared_ptr<StatisticsReport> statistics;
     try {
         ExecutableNetwork exeNetwork;
+        CNNNetwork cnnNetwork;
 
         // ----------------- 1. Parsing and validating input arguments
         // -------------------------------------------------
@@ -260,6 +289,15 @@ int main(int argc, char* argv[]) {
                 if (isFlagSetInCommandLine("enforcebf16"))
                     device_config[CONFIG_KEY(ENFORCE_BF16)] = FLAGS_enforcebf16 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
 
+                if (isFlagSetInCommandLine("dataflow"))
+                    device_config[CONFIG_KEY(CPU_DATAFLOW_EXECUTION)] = FLAGS_dataflow ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
+
+                if (FLAGS_pc_histograms) {
+                    device_config[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
+                    device_config[CONFIG_KEY(CPU_PERF_COUNT_HISTOGRAMS)] = CONFIG_VALUE(YES);
+                    perf_counts = true;
+                }
+
                 if (isFlagSetInCommandLine("pin")) {
                     // set to user defined value
                     device_config[CONFIG_KEY(CPU_BIND_THREAD)] = FLAGS_pin;
@@ -360,7 +398,7 @@ int main(int argc, char* argv[]) {
             slog::info << "Loading network files" << slog::endl;
 
             auto startTime = Time::now();
-            CNNNetwork cnnNetwork = ie.ReadNetwork(FLAGS_m);
+            cnnNetwork = ie.ReadNetwork(FLAGS_m);
             auto duration_ms = double_to_string(get_total_ms_time(startTime));
             slog::info << "Read network took " << duration_ms << " ms" << slog::endl;
             if (statistics)
@@ -511,13 +549,24 @@ int main(int argc, char* argv[]) {
                                                                                           {ss.str(), nstreams.second},
                                                                                       });
             }
+            if (FLAGS_rate > 0.0) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG, {
+                                                                                          {"open-loop arrival rate (1/s)", double_to_string(FLAGS_rate)},
+                                                                                          {"open-loop arrival distribution", FLAGS_arrival},
+                                                                                      });
+            }
+            if (isFlagSetInCommandLine("dataflow")) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG, {
+                                                                                          {"CPU dataflow execution", FLAGS_dataflow ? "YES" : "NO"},
+                                                                                      });
+            }
         }
 
         // ----------------- 9. Creating infer requests and filling input blobs
         // ----------------------------------------
         next_step();
 
-        InferRequestsQueue inferRequestsQueue(exeNetwork, nireq);
+        InferRequestsQueue inferRequestsQueue(exeNetwork, nireq, statistics != nullptr);
         fillBlobs(inputFiles, batchSize, app_inputs_info, inferRequestsQueue.requests);
 
         // ----------------- 10. Measuring performance
@@ -544,6 +593,9 @@ int main(int argc, char* argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        if (FLAGS_rate > 0.0) {
+            ss << ", open-loop " << FLAGS_arrival << " arrivals at " << FLAGS_rate << " requests/s";
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << getDurationInMilliseconds(duration_seconds) << " ms duration";
@@ -584,8 +636,21 @@ int main(int argc, char* argv[]) {
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
+        // In the open-loop mode requests arrive on schedule independently of the completion of the previous ones.
+        // If all infer requests are busy, the arrived request waits and the waiting time is counted in its latency.
+        const bool openLoop = FLAGS_rate > 0.0;
+        std::mt19937_64 arrivalGenerator;
+        std::exponential_distribution<double> poissonIntervals(openLoop ? FLAGS_rate : 1.0);
+        auto nextArrival = startTime;
+
         while ((niter != 0LL && iteration < niter) || (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                const double interval = FLAGS_arrival == "constant" ? 1.0 / FLAGS_rate : poissonIntervals(arrivalGenerator);
+                nextArrival += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+                std::this_thread::sleep_until(nextArrival);
+            }
+
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
@@ -593,6 +658,9 @@ int main(int argc, char* argv[]) {
 
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
+            } else if (openLoop) {
+                inferRequest->wait();
+                inferRequest->startAsync(nextArrival);
             } else {
                 // As the inference request is currently idle, the wait() adds no
                 // additional overhead (and should return immediately). The primary
@@ -625,6 +693,14 @@ int main(int argc, char* argv[]) {
         inferRequestsQueue.waitAll();
 
         double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        const auto& latencyHistogram = inferRequestsQueue.getLatencyHistogram();
+        const std::vector<std::pair<std::string, double>> latencyPercentiles = {
+            {"p50", latencyHistogram.percentile(50.0)},
+            {"p90", latencyHistogram.percentile(90.0)},
+            {"p99", latencyHistogram.percentile(99.0)},
+            {"p99.9", latencyHistogram.percentile(99.9)},
+            {"max", latencyHistogram.max()},
+        };
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
 
@@ -637,12 +713,42 @@ int main(int argc, char* argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
                                                                                              {"latency (ms)", double_to_string(latency)},
                                                                                          });
+                for (const auto& percentile : latencyPercentiles) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
+                                                                                                 {"latency " + percentile.first + " (ms)",
+                                                                                                  double_to_string(percentile.second)},
+                                                                                             });
+                }
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"throughput", double_to_string(fps)}});
         }
 
         progressBar.finish();
 
+        // The dataflow execution speeds up a single inference, so the latency of one synchronous request is compared
+        // with the same network loaded for the sequential execution
+        double dataflowSpeedup = 0.0;
+        if (FLAGS_dataflow && device_name == "CPU") {
+            if (isNetworkCompiled) {
+                slog::warn << "The dataflow execution speedup is not measured for the compiled network" << slog::endl;
+            } else {
+                const std::map<std::string, std::string> sequentialConfig = {{CONFIG_KEY(CPU_DATAFLOW_EXECUTION), CONFIG_VALUE(NO)}};
+                auto sequentialNetwork =
+                    FLAGS_load_from_file ? ie.LoadNetwork(FLAGS_m, device_name, sequentialConfig) : ie.LoadNetwork(cnnNetwork, device_name, sequentialConfig);
+                const size_t comparisonIterations = std::max<size_t>(1, std::min<size_t>(iteration, 100));
+                const double dataflowLatency = getSyncLatency(exeNetwork, inputFiles, batchSize, app_inputs_info, comparisonIterations);
+                const double sequentialLatency = getSyncLatency(sequentialNetwork, inputFiles, batchSize, app_inputs_info, comparisonIterations);
+                dataflowSpeedup = sequentialLatency / dataflowLatency;
+                if (statistics) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
+                                                                                                 {"dataflow sync latency (ms)", double_to_string(dataflowLatency)},
+                                                                                                 {"sequential sync latency (ms)", double_to_string(sequentialLatency)},
+                                                                                                 {"dataflow speedup", double_to_string(dataflowSpeedup)},
+                                                                                             });
+                }
+            }
+        }
+
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
         next_step();
@@ -677,16 +783,49 @@ int main(int argc, char* argv[]) {
             if (statistics) {
                 statistics->dumpPerformanceCounters(perfCounts);
             }
+            if (FLAGS_pc_histograms) {
+                try {
+                    std::string json = exeNetwork.GetMetric(METRIC_KEY(CPU_PERF_COUNT_HISTOGRAMS_JSON));
+                    std::string csv = exeNetwork.GetMetric(METRIC_KEY(CPU_PERF_COUNT_HISTOGRAMS_CSV));
+                    if (FLAGS_pc) {
+                        slog::info << "Node execution time histograms:" << slog::endl;
+                        std::cout << csv << std::endl;
+                    }
+                    if (statistics) {
+                        statistics->dumpNodeLatencyHistograms(json, csv);
+                    }
+                } catch (const std::exception& ex) {
+                    slog::err << "Can't get node execution time histograms: " << ex.what() << slog::endl;
+                }
+            }
         }
 
-        if (statistics)
+        if (statistics) {
+            std::vector<StatisticsReport::RequestTimestamps> timestamps;
+            auto sinceStart = [&](Time::time_point timePoint) {
+                return std::chrono::duration_cast<ns>(timePoint - startTime).count() * 0.000001;
+            };
+            for (const auto& t : inferRequestsQueue.getTimestamps()) {
+                timestamps.push_back({t.id, sinceStart(t.scheduled), sinceStart(t.started), sinceStart(t.completed)});
+            }
+            statistics->dumpRequestsTimestamps(timestamps);
             statistics->dump();
+        }
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "Latency percentiles:";
+            for (const auto& percentile : latencyPercentiles) {
+                std::cout << " " << percentile.first << " " << double_to_string(percentile.second) << " ms";
+            }
+            std::cout << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (dataflowSpeedup > 0.0) {
+            std::cout << "Dataflow speedup: " << double_to_string(dataflowSpeedup) << "x (synchronous latency vs sequential execution)" << std::endl;
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
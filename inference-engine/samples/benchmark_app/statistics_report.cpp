@@ -5,6 +5,8 @@
 #include "statistics_report.hpp"
 
 #include <algorithm>
+#include <fstream>
+#include <stdexcept>
 #include <map>
 #include <string>
 #include <utility>
@@ -141,3 +143,30 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpRequestsTimestamps(const std::vector<RequestTimestamps>& timestamps) {
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_requests_timestamps.csv");
+    dumper << "requestId"
+           << "scheduled (ms)"
+           << "started (ms)"
+           << "completed (ms)"
+           << "latency (ms)";
+    dumper.endLine();
+    for (const auto& t : timestamps) {
+        dumper << t.requestId << t.scheduled << t.started << t.completed << t.completed - t.scheduled;
+        dumper.endLine();
+    }
+    slog::info << "Requests timestamps are stored to " << dumper.getFilename() << slog::endl;
+}
+
+void StatisticsReport::dumpNodeLatencyHistograms(const std::string& json, const std::string& csv) {
+    const std::string path = _config.report_folder + _separator + "benchmark_node_latency_histograms";
+    for (const auto& report : {std::make_pair(path + ".json", &json), std::make_pair(path + ".csv", &csv)}) {
+        std::ofstream file(report.first);
+        if (!file.is_open()) {
+            throw std::runtime_error("Can't open the file " + report.first);
+        }
+        file << *report.second;
+    }
+    slog::info << "Node latency histograms are stored to " << path << ".json and " << path << ".csv" << slog::endl;
+}
@@ -24,6 +24,14 @@ public:
     typedef std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> PerformaceCounters;
     typedef std::vector<std::pair<std::string, std::string>> Parameters;
 
+    /// @brief Times of an inference request in milliseconds since the start of measurements
+    struct RequestTimestamps {
+        size_t requestId;
+        double scheduled;
+        double started;
+        double completed;
+    };
+
     struct Config {
         std::string report_type;
         std::string report_folder;
@@ -56,6 +64,11 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters>& perfCounts);
 
+    void dumpRequestsTimestamps(const std::vector<RequestTimestamps>& timestamps);
+
+    /// @brief Stores the node execution time histograms reported by the device as JSON and CSV text
+    void dumpNodeLatencyHistograms(const std::string& json, const std::string& csv);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper, const PerformaceCounters& perfCounts);
 
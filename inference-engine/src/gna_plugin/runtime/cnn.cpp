@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <gna_plugin_log.hpp>
+#include <ie_parallel.hpp>
 
 #include "cnn.h"
 #include "backend/dnn_types.h"
@@ -33,17 +34,18 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    InferenceEngine::parallel_for(num_filter_outputs, [&](uint32_t j) {
         float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
+        for (uint32_t i = 0; i < num_filters; i++) {
             float *ptr_coef = ptr_filters + i * num_filter_coefficients;
             float sum = ptr_biases[i];
             for (uint32_t k = 0; k < num_filter_coefficients; k++) {
                 sum += ptr_in[k] * ptr_coef[k];
             }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+            ptr_outputs[j * num_filters + i] = sum;
         }
-    }
+    });
 }
 
 void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t number_type, const bool sumPoolingOverRide) {
@@ -209,20 +211,19 @@ float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsign
     const auto zPW = zeroPadding[1];
     float output = 0;
     for (unsigned kh = 0; kh < KH; kh++) {
+        if (matchesPaddedArea(kh, oh, IH, zPH, cSH)) {
+            continue;
+        }
+        const auto ih = (cSH * oh + kh) - zPH;
         for (unsigned kw = 0; kw < KW; kw++) {
+            if (matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
+                continue;
+            }
+            const auto iw = (cSW * ow + kw) - zPW;
+            const auto imageElements = image + getQubeIndex(ih, iw, 0u, IW, IC);
+            const auto filterElements = filter + getQubeIndex(kh, kw, 0u, KW, KC);
             for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
+                output += imageElements[kc] * filterElements[kc];
             }
         }
     }
@@ -258,8 +259,10 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    InferenceEngine::parallel_for(OC, [&](unsigned oc) {
+        const auto kernelIndex = oc * kernelStride;
         for (unsigned ow = 0; ow < OW; ow++) {
             for (unsigned oh = 0; oh < OH; oh++) {
                 const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
@@ -270,9 +273,7 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
                     component->op.conv2D.zeroPadding);
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 #endif
@@ -1,14 +1,58 @@
 // Copyright (C) 2018-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines (for reference)
+//
+// Every output element is accumulated in the same order as in the naive implementation,
+// the loops are only reordered to vectorize over blocks of independent outputs and parallelized over rows,
+// so the results are bit-exact with the reference.
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 
+#include <ie_parallel.hpp>
+
 #include "floatmath.h"
 
+namespace {
+// number of C row elements accumulated in registers at once
+constexpr int kBlockN = 8;
+
+template <int width>
+inline void sgemm_row_block(const float *A, const int incA, const int K,
+                            const float *B, const int ldb, const float beta, float *C) {
+    float sum[width];
+    for (int j = 0; j < width; j++) {
+        sum[j] = (beta == 1.0) ? C[j] : 0;
+    }
+    for (int k = 0; k < K; k++) {
+        const float a = A[k * incA];
+        const float *Brow = B + k * ldb;
+        for (int j = 0; j < width; j++) {
+            sum[j] += a * Brow[j];
+        }
+    }
+    for (int j = 0; j < width; j++) {
+        C[j] = sum[j];
+    }
+}
+
+// C[i, :] = (beta == 1 ? C[i, :] : 0) + sum_k A[i, k] * B[k, :]
+inline void sgemm_row(const float *A, const int incA, const int K,
+                      const float *B, const int ldb, const int N,
+                      const float beta, float *C) {
+    int j = 0;
+    for (; j + kBlockN <= N; j += kBlockN) {
+        sgemm_row_block<kBlockN>(A, incA, K, B + j, ldb, beta, C + j);
+    }
+    for (; j < N; j++) {
+        sgemm_row_block<1>(A, incA, K, B + j, ldb, beta, C + j);
+    }
+}
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
@@ -19,44 +63,30 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
         throw -1;
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        InferenceEngine::parallel_for(M, [&](int i) {
+            sgemm_row(A + i * lda, 1, K, B, ldb, N, beta, C + i * ldc);
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
+        InferenceEngine::parallel_for(M, [&](int i) {
+            for (int j = 0; j < N; j++) {
                 float sum;
                 sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
+                for (int k = 0; k < K; k++) {
                     sum += alpha * A[i * lda + k] * B[j * ldb + k];
                 }
                 C[i * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        InferenceEngine::parallel_for(M, [&](int i) {
+            sgemm_row(A + i, lda, K, B, ldb, N, beta, C + i * ldc);
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
         throw -1;
@@ -97,47 +127,31 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const MKL_INT lda, const float *B, const MKL_INT ldb,
                         const float beta, float *C, const MKL_INT ldc,
                         const uint32_t *OutputList, const MKL_INT L) {
-    int i, j, k, l;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm_subset!\n");
         throw -1;
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        InferenceEngine::parallel_for(L, [&](int l) {
+            sgemm_row(A + OutputList[l] * lda, 1, K, B, ldb, N, beta, C + l * ldc);
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (l = 0; l < L; l++) {
+        InferenceEngine::parallel_for(M, [&](int i) {
+            for (int l = 0; l < L; l++) {
                 float sum;
-                j = OutputList[l];
+                int j = OutputList[l];
                 sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
+                for (int k = 0; k < K; k++) {
                     sum += alpha * A[i * lda + k] * B[j * ldb + k];
                 }
                 C[i * ldc + l] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        InferenceEngine::parallel_for(L, [&](int l) {
+            sgemm_row(A + OutputList[l], lda, K, B, ldb, N, beta, C + l * ldc);
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm_subset!\n");
         throw -1;
@@ -155,18 +169,17 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
+    InferenceEngine::parallel_for(num_rows, [&](uint32_t i) {
         float sum = B[i];
-        for (j = 0; j < K1; j++) {
+        for (uint32_t j = 0; j < K1; j++) {
             sum += A1[j] * X[i * num_columns + j];
         }
-        for (j = K1; j < num_columns; j++) {
+        for (uint32_t j = K1; j < num_columns; j++) {
             sum += A2[j - K1] * X[i * num_columns + j];
         }
         C[i] = sum;
-    }
+    });
 }
 
 #ifdef __cplusplus
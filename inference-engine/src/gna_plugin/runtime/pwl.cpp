@@ -10,6 +10,8 @@
 #include <cstdint>
 #include <algorithm>
 
+#include <ie_parallel.hpp>
+
 #ifdef _NO_MKL_
 #include <cmath>
 #include "backend/make_pwl.hpp"
@@ -952,6 +954,48 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+namespace {
+// minimal number of elements to split activation between threads
+constexpr size_t kPwlParallelGrain = 4096;
+
+struct PwlRange {
+    const float *ptr_in;
+    float *ptr_out;
+    uint32_t num_columns;
+    uint32_t num_row_start;
+    uint32_t num_row_end;
+    uint32_t num_col_start;
+    uint32_t num_col_end;
+};
+
+// applies elementwise function to the rectangle of the rows-major matrix, elements are split evenly between threads
+template <typename F>
+void PwlApply32Elementwise(const PwlRange& range, const F& func) {
+    const auto ptr_in = range.ptr_in;
+    const auto ptr_out = range.ptr_out;
+    const auto num_columns = range.num_columns;
+    const auto num_row_start = range.num_row_start;
+    const auto num_row_end = range.num_row_end;
+    const auto num_col_start = range.num_col_start;
+    const auto num_col_end = range.num_col_end;
+    const size_t num_cols = num_col_end - num_col_start + 1;
+    const size_t num_elements = (num_row_end - num_row_start + 1) * num_cols;
+    InferenceEngine::parallel_nt(num_elements < kPwlParallelGrain ? 1 : 0, [&](int ithr, int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(num_elements, nthr, ithr, start, end);
+        size_t i = num_row_start + start / num_cols;
+        size_t j = num_col_start + start % num_cols;
+        for (size_t e = start; e < end; e++) {
+            ptr_out[i * num_columns + j] = func(ptr_in[i * num_columns + j]);
+            if (++j > num_col_end) {
+                j = num_col_start;
+                i++;
+            }
+        }
+    });
+}
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
@@ -961,120 +1005,69 @@ void PwlApply32(intel_dnn_component_t *component,
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
     uint32_t num_columns = component->num_columns_in;
+    const PwlRange range{ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end};
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return 0.5 * (1.0 + tanh(0.5 * x)); });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return tanh(x); });
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return x / (1.0 + fabs(x)); });
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
-            }
+        case kActRelu: {
+            const float negative_slope = transform->func_id.args.lrelu.negative_slope;
+            PwlApply32Elementwise(range, [=](float x) -> float { return (x < 0.0f) ? x * negative_slope : x; });
             break;
+        }
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return x; });
             break;
         case kActKaldiLstmClipping: {
             float upper_limit = component->op.pwl.func_id.args.clamp.high;
             float lower_limit = component->op.pwl.func_id.args.clamp.low;
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > upper_limit) {
-                        ptr_out[i * num_columns + j] = upper_limit;
-                    } else if (val < lower_limit) {
-                        ptr_out[i * num_columns + j] = lower_limit;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
+            PwlApply32Elementwise(range, [=](float val) -> float {
+                if (val > upper_limit) {
+                    return upper_limit;
+                } else if (val < lower_limit) {
+                    return lower_limit;
                 }
-            }
+                return val;
+            });
             break;
         }
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return exp(x); });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return log(x); });
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return fabs(x); });
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return (x == 0) ? 0.0 : ((x > 0) ? 1.0 : -1.0); });
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return -1.0 * log(x); });
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(range, [](float x) -> float { return -0.5 * log(x); });
             break;
         case kActPow: {
-                float exponent = transform->func_id.args.pow.exponent;
-                float scale = transform->func_id.args.pow.scale;
-                float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                        ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
-                    }
-                }
-            }
+            float exponent = transform->func_id.args.pow.exponent;
+            float scale = transform->func_id.args.pow.scale;
+            float offset = transform->func_id.args.pow.offset;
+            PwlApply32Elementwise(range, [=](float x) -> float { return pow(offset + scale * x, exponent); });
             break;
+        }
         case kActFakeQuantize: {
             bool clamping = true;
             double levels  = transform->func_id.fqParams.levels;
 
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+            InferenceEngine::parallel_for(num_row_end - num_row_start + 1, [&](uint32_t row) {
+                const uint32_t i = num_row_start + row;
                 auto inputChannel  = transform->func_id.fqParams.inputPerChannel ? i : 0;
                 auto outputChannel = transform->func_id.fqParams.outputPerChannel ? i : 0;
 
@@ -1103,7 +1096,7 @@ void PwlApply32(intel_dnn_component_t *component,
                             (levels - 1) * (output_high - output_low) + output_low;
                     }
                 }
-            }
+            });
             break;
         }
         case kActCustom:
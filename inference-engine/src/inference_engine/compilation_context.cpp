@@ -12,13 +12,28 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "transformations/serialize.hpp"
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/op/loop.hpp"
+#include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/op/util/variable.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph_ops/framework_node.hpp"
 #include "transformations/rt_info/dequantization_attribute.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -62,6 +77,326 @@ public:
     }
 };
 
+static std::size_t hash_rt_info(std::size_t seed, const ngraph::Node& op) {
+    const auto& rt = op.get_rt_info();
+    for (const auto& rtMapData : rt) {
+        seed = hash_combine(seed, rtMapData.first);
+
+        if (auto stringData = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(rtMapData.second)) {
+            seed = hash_combine(seed, stringData->get());
+        } else if (auto intData = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::int64_t>>(rtMapData.second)) {
+            seed = hash_combine(seed, intData->get());
+        } else if (auto deq = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(rtMapData.second)) {
+            seed = hash_combine(seed, deq->get().getDequantizationAttr());
+        } else if (auto fNames = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::FusedNames>>(rtMapData.second)) {
+            seed = hash_combine(seed, fNames->get().getNames());
+        } else if (auto prim = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(rtMapData.second)) {
+            seed = hash_combine(seed, prim->get().getPrimitivesPriority());
+        }
+    }
+    return seed;
+}
+
+// FNV-1a over 64-bit words
+static std::uint64_t hash_data(const char* data, std::size_t size) {
+    constexpr std::uint64_t prime = 0x100000001b3ULL;
+    std::uint64_t res = 0xcbf29ce484222325ULL ^ size;
+
+    std::size_t n64 = size / sizeof(std::uint64_t);
+    for (std::size_t i = 0; i < n64; i++) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i * sizeof(word), sizeof(word));
+        res = (res ^ word) * prime;
+    }
+    for (std::size_t i = n64 * sizeof(std::uint64_t); i < size; i++) {
+        res = (res ^ static_cast<unsigned char>(data[i])) * prime;
+    }
+    return res;
+}
+
+// Hashes of constants data. The hash is computed once per buffer and is reused while the buffer is alive and still
+// owns the same memory, e.g. when the same network is loaded to several devices. The entry is computed again when the
+// buffer data pointer or size differs from the hashed ones. Constant data is immutable: changing the data of a
+// Constant in place isn't supported and keeps the memoized hash, replace the Constant instead
+class ConstantHashCache {
+    using BufferPtr = std::shared_ptr<ngraph::runtime::AlignedBuffer>;
+    using BufferWeakPtr = std::weak_ptr<ngraph::runtime::AlignedBuffer>;
+
+    struct Entry {
+        const void* data;
+        std::size_t size;
+        std::uint64_t hash;
+    };
+
+    std::mutex m_mutex;
+    std::map<BufferWeakPtr, Entry, std::owner_less<BufferWeakPtr>> m_hashes;
+
+public:
+    std::uint64_t get(const BufferPtr& buffer) {
+        const void* data = buffer->get_ptr();
+        const auto size = buffer->size();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto found = m_hashes.find(buffer);
+            if (found != m_hashes.end() && found->second.data == data && found->second.size == size)
+                return found->second.hash;
+        }
+
+        auto res = hash_data(static_cast<const char*>(data), size);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_hashes[buffer] = Entry{data, size, res};
+        return res;
+    }
+
+    void removeExpired() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_hashes.begin(); it != m_hashes.end();) {
+            if (it->first.expired())
+                it = m_hashes.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    static ConstantHashCache& instance() {
+        static ConstantHashCache cache;
+        return cache;
+    }
+};
+
+static bool hash_function(std::size_t& seed, const ngraph::Function& function);
+
+// Combines all attributes of the node into the seed.
+// Attributes of unknown types are reported via isSupported()
+class HashAttributeVisitor : public ngraph::AttributeVisitor {
+    std::size_t& m_seed;
+    bool m_supported = true;
+
+    template <typename T>
+    void combine(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void combine(const std::string& name, const std::vector<T>& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value.size());
+        for (const auto& v : value)
+            m_seed = hash_combine(m_seed, v);
+    }
+
+public:
+    explicit HashAttributeVisitor(std::size_t& seed) : m_seed(seed) {}
+
+    bool isSupported() const {
+        return m_supported;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        using namespace ngraph;
+        using SubGraphOp = op::util::SubGraphOp;
+        m_seed = hash_combine(m_seed, name);
+
+        if (auto a = as_type<AttributeAdapter<std::shared_ptr<runtime::AlignedBuffer>>>(&adapter)) {
+            m_seed = hash_combine(m_seed, ConstantHashCache::instance().get(a->get()));
+        } else if (auto a = as_type<AttributeAdapter<std::shared_ptr<Variable>>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get()->get_info().variable_id);
+        } else if (auto a = as_type<AttributeAdapter<std::vector<std::shared_ptr<SubGraphOp::InputDescription>>>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_input_index);
+                m_seed = hash_combine(m_seed, desc->m_body_parameter_index);
+                if (auto slice = as_type_ptr<SubGraphOp::SliceInputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, slice->m_start);
+                    m_seed = hash_combine(m_seed, slice->m_stride);
+                    m_seed = hash_combine(m_seed, slice->m_part_size);
+                    m_seed = hash_combine(m_seed, slice->m_end);
+                    m_seed = hash_combine(m_seed, slice->m_axis);
+                } else if (auto merged = as_type_ptr<SubGraphOp::MergedInputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, merged->m_body_value_index);
+                }
+            }
+        } else if (auto a = as_type<AttributeAdapter<std::vector<std::shared_ptr<SubGraphOp::OutputDescription>>>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_body_value_index);
+                m_seed = hash_combine(m_seed, desc->m_output_index);
+                if (auto concat = as_type_ptr<SubGraphOp::ConcatOutputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, concat->m_start);
+                    m_seed = hash_combine(m_seed, concat->m_stride);
+                    m_seed = hash_combine(m_seed, concat->m_part_size);
+                    m_seed = hash_combine(m_seed, concat->m_end);
+                    m_seed = hash_combine(m_seed, concat->m_axis);
+                } else if (auto body = as_type_ptr<SubGraphOp::BodyOutputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, body->m_iteration);
+                }
+            }
+        } else if (auto a = as_type<AttributeAdapter<op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        } else if (auto a = as_type<AttributeAdapter<op::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            m_seed = hash_combine(m_seed, attrs.get_type_name());
+            m_seed = hash_combine(m_seed, attrs.get_opset_name());
+            std::map<std::string, std::string> sortedAttrs(attrs.begin(), attrs.end());
+            for (const auto& attr : sortedAttrs) {
+                m_seed = hash_combine(m_seed, attr.first);
+                m_seed = hash_combine(m_seed, attr.second);
+            }
+        } else {
+            m_supported = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        m_supported = m_supported && hash_function(m_seed, *adapter.get());
+    }
+};
+
+static bool hash_node(std::size_t& seed, const ngraph::Node& node,
+                      const std::unordered_map<const ngraph::Node*, std::size_t>& indices) {
+    const auto& typeInfo = node.get_type_info();
+    seed = hash_combine(seed, std::string(typeInfo.name));
+    seed = hash_combine(seed, typeInfo.version);
+    seed = hash_combine(seed, node.get_friendly_name());
+
+    for (const auto& input : node.inputs()) {
+        const auto& source = input.get_source_output();
+        seed = hash_combine(seed, indices.at(source.get_node()));
+        seed = hash_combine(seed, source.get_index());
+    }
+
+    for (const auto& output : node.outputs()) {
+        seed = hash_combine(seed, output.get_element_type().get_type_name());
+        const auto& shape = output.get_partial_shape();
+        seed = hash_combine(seed, shape.rank().is_static());
+        if (shape.rank().is_static()) {
+            for (const auto& dim : shape) {
+                seed = hash_combine(seed, dim.is_static() ? dim.get_length() : -1);
+            }
+        }
+        const auto& names = output.get_tensor().get_names();
+        std::vector<std::string> sortedNames(names.begin(), names.end());
+        std::sort(sortedNames.begin(), sortedNames.end());
+        for (const auto& name : sortedNames) {
+            seed = hash_combine(seed, name);
+        }
+    }
+
+    HashAttributeVisitor visitor(seed);
+    const_cast<ngraph::Node&>(node).visit_attributes(visitor);
+
+    seed = hash_rt_info(seed, node);
+    return visitor.isSupported();
+}
+
+// Walks the function and combines per-node hashes computed in parallel.
+// Returns false if the function has attributes which cannot be hashed directly
+static bool hash_function(std::size_t& seed, const ngraph::Function& function) {
+    const auto ops = function.get_ordered_ops();
+
+    std::unordered_map<const ngraph::Node*, std::size_t> indices;
+    for (std::size_t i = 0; i < ops.size(); i++) {
+        indices[ops[i].get()] = i;
+    }
+
+    std::vector<std::size_t> nodeHashes(ops.size(), 0);
+    std::atomic<bool> supported{true};
+    parallel_for(ops.size(), [&](std::size_t i) {
+        if (!hash_node(nodeHashes[i], *ops[i], indices))
+            supported = false;
+    });
+    if (!supported)
+        return false;
+
+    seed = hash_combine(seed, function.get_friendly_name());
+    for (const auto& nodeHash : nodeHashes) {
+        seed = hash_combine(seed, nodeHash);
+    }
+    for (const auto& parameter : function.get_parameters()) {
+        seed = hash_combine(seed, indices.at(parameter.get()));
+    }
+    for (const auto& result : function.get_results()) {
+        seed = hash_combine(seed, indices.at(result.get()));
+    }
+    for (const auto& sink : function.get_sinks()) {
+        seed = hash_combine(seed, indices.at(sink.get()));
+    }
+    return true;
+}
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -87,49 +422,38 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
-
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ngraph::pass::Serialize serializer(xml, bin,
-        ngraph::pass::Serialize::Version::IR_V10);
-    serializer.run_on_function(net.getFunction());
-
-    // 2. Compute hash on serialized data and options
+    // 1. Compute hash on the function structure, attributes and constants data
     size_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    ConstantHashCache::instance().removeExpired();
+    if (!hash_function(seed, *network.getFunction())) {
+        // Function has attributes of unknown types, so hash the serialized IR and runtime information instead
+        OstreamHashWrapper xmlHash;
+        OstreamHashWrapper binHash;
+        std::ostream xml(&xmlHash);
+        std::ostream bin(&binHash);
+
+        CNNNetwork net(network);
+        ngraph::pass::Serialize serializer(xml, bin,
+            ngraph::pass::Serialize::Version::IR_V10);
+        serializer.run_on_function(net.getFunction());
+
+        seed = 0;
+        seed = hash_combine(seed, xmlHash.getResult());
+        seed = hash_combine(seed, binHash.getResult());
+
+        for (const auto& op : network.getFunction()->get_ordered_ops()) {
+            seed = hash_rt_info(seed, *op);
+        }
+    }
 
+    // 2. Add compile options
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
     }
 
-    // 3. Add runtime information which may not be serialized
-    for (const auto& op : network.getFunction()->get_ordered_ops()) {
-        const auto& rt = op->get_rt_info();
-        for (const auto& rtMapData : rt) {
-            seed = hash_combine(seed, rtMapData.first);
-
-            if (auto stringData = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(rtMapData.second)) {
-                seed = hash_combine(seed, stringData->get());
-            } else if (auto intData = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::int64_t>>(rtMapData.second)) {
-                seed = hash_combine(seed, intData->get());
-            } else if (auto deq = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(rtMapData.second)) {
-                seed = hash_combine(seed, deq->get().getDequantizationAttr());
-            } else if (auto fNames = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::FusedNames>>(rtMapData.second)) {
-                seed = hash_combine(seed, fNames->get().getNames());
-            } else if (auto prim = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(rtMapData.second)) {
-                seed = hash_combine(seed, prim->get().getPrimitivesPriority());
-            }
-        }
-    }
-
-    // 4. Add inputs info
+    // 3. Add inputs info
     for (const auto& input : network.getInputsInfo()) {
         InputInfo::Ptr info = input.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
@@ -150,7 +474,7 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
         }
     }
 
-    // 5. Add outputs info
+    // 4. Add outputs info
     for (const auto& output : network.getOutputsInfo()) {
         DataPtr info = output.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <atomic>
 #include <sys/stat.h>
 
 #include <ie_core.hpp>
@@ -196,6 +197,22 @@ class Core::Impl : public ICore {
 
                 config.erase(it);
             }
+
+            it = config.find(CONFIG_KEY(MMAP_WEIGHTS));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _weightsMapping = details::WeightsMapping::CopyOnWrite;
+                } else if (it->second == CONFIG_VALUE(READ_ONLY)) {
+                    _weightsMapping = details::WeightsMapping::ReadOnly;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _weightsMapping = details::WeightsMapping::None;
+                } else {
+                    IE_THROW() << "Wrong value " << it->second << " for property key " << CONFIG_KEY(MMAP_WEIGHTS)
+                               << ". Expected only YES/NO/READ_ONLY";
+                }
+
+                config.erase(it);
+            }
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -204,9 +221,14 @@ class Core::Impl : public ICore {
             return _cacheConfig;
         }
 
+        details::WeightsMapping getWeightsMapping() const {
+            return _weightsMapping;
+        }
+
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic<details::WeightsMapping> _weightsMapping {details::WeightsMapping::None};
     };
 
     // Core settings (cache config, etc)
@@ -477,7 +499,7 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "Core::Impl::ReadNetwork from file");
-        return details::ReadNetwork(modelPath, binPath, extensions);
+        return details::ReadNetwork(modelPath, binPath, extensions, coreConfig.getWeightsMapping());
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
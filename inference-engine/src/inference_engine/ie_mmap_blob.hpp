@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the memory mapped blob creation
+ *
+ * @file ie_mmap_blob.hpp
+ */
+
+#pragma once
+
+#include <ie_blob.h>
+
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Defines how a weights file is brought into memory
+ */
+enum class WeightsMapping {
+    None,         //!< The file is read into a newly allocated blob
+    CopyOnWrite,  //!< The file is mapped, written pages are privately copied
+    ReadOnly,     //!< The file is mapped read-only, a write to the data is an access violation
+};
+
+/**
+ * @brief Creates U8 blob over a memory mapped file instead of reading the file content.
+ *
+ * Until the data is written, its pages belong to the OS page cache, so several processes
+ * which map the same file share physical memory. The mapping is released together with the last
+ * reference to the blob.
+ *
+ * @param path Path to the file to map
+ * @param mapping Mapping mode, either WeightsMapping::CopyOnWrite or WeightsMapping::ReadOnly
+ * @return Blob which memory is the file mapping
+ */
+Blob::Ptr mapFileToBlob(const std::string& path, WeightsMapping mapping);
+
+}  // namespace details
+}  // namespace InferenceEngine
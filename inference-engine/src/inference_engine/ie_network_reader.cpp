@@ -150,7 +150,8 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
 
 }  // namespace
 
-CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
+CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                                details::WeightsMapping mapping) {
     // Register readers if it is needed
     registerReaders();
 
@@ -199,18 +200,23 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
+                Blob::Ptr weights;
+                if (mapping != details::WeightsMapping::None) {
+                    // Constants created by the reader keep the mapping alive and point directly to its pages
+                    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "MapNetworkWeights");
+                    weights = details::mapFileToBlob(bPath, mapping);
+                } else {
+                    std::ifstream binStream;
+                    binStream.open(weights_path, std::ios::binary);
+                    if (!binStream.is_open())
+                        IE_THROW() << "Weights file " << bPath << " cannot be opened!";
+
+                    binStream.seekg(0, std::ios::end);
+                    size_t fileSize = binStream.tellg();
+                    binStream.seekg(0, std::ios::beg);
+
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
 
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-
-                {
                     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
                     weights->allocate();
                     binStream.read(weights->buffer(), fileSize);
@@ -9,6 +9,8 @@
 #include <ie_blob.h>
 #include <string>
 
+#include "ie_mmap_blob.hpp"
+
 namespace InferenceEngine {
 namespace details {
 
@@ -18,9 +20,11 @@ namespace details {
  * @param binPath path to bin file, if path is empty, will try to read bin file with the same name as xml and
  * if bin file with the same name was not found, will load IR without weights.
  * @param exts vector with extensions
+ * @param mapping defines whether the bin file is read into memory or memory mapped
  * @return CNNNetwork
  */
-CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts);
+CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                       WeightsMapping mapping = WeightsMapping::None);
 /**
  * @brief Reads IR xml and bin (with the same name) files
  * @param model string with IR
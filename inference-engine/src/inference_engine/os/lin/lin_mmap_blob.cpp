@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+#include "ie_mmap_blob.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+class MMapAllocator : public IAllocator {
+    void* _data = MAP_FAILED;
+    size_t _size = 0;
+
+public:
+    MMapAllocator(const std::string& path, WeightsMapping mapping) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            IE_THROW() << "Can not open file " << path << " for mapping: " << std::strerror(errno);
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1) {
+            close(fd);
+            IE_THROW() << "Can not get size of file " << path << ": " << std::strerror(errno);
+        }
+        _size = static_cast<size_t>(sb.st_size);
+
+        if (_size > 0) {
+            // MAP_PRIVATE mapping shares clean pages with other processes, written pages are copied
+            _data = mapping == WeightsMapping::ReadOnly ?
+                    mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0) :
+                    mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        }
+        // the mapping stays valid after the descriptor is closed
+        close(fd);
+
+        if (_size > 0 && _data == MAP_FAILED)
+            IE_THROW() << "Can not map file " << path << ": " << std::strerror(errno);
+    }
+
+    ~MMapAllocator() {
+        if (_data != MAP_FAILED)
+            munmap(_data, _size);
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return (_data != MAP_FAILED && size <= _size) ? _data : nullptr;
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+};
+
+}  // namespace
+
+Blob::Ptr mapFileToBlob(const std::string& path, WeightsMapping mapping) {
+    auto allocator = std::make_shared<MMapAllocator>(path, mapping);
+    auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {allocator->size()}, Layout::C), allocator);
+    blob->allocate();
+    return blob;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
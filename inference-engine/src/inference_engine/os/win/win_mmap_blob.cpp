@@ -0,0 +1,104 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+
+#include <windows.h>
+
+#include <memory>
+
+#include "ie_mmap_blob.hpp"
+#include "file_utils.h"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+class MMapAllocator : public IAllocator {
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = nullptr;
+    void* _data = nullptr;
+    size_t _size = 0;
+
+    void release() {
+        if (_data != nullptr)
+            UnmapViewOfFile(_data);
+        if (_mapping != nullptr)
+            CloseHandle(_mapping);
+        if (_file != INVALID_HANDLE_VALUE)
+            CloseHandle(_file);
+    }
+
+public:
+    MMapAllocator(const std::string& path, WeightsMapping mapping) {
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+        std::wstring file_path = FileUtils::multiByteCharToWString(path.c_str());
+        _file = CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+        _file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+        if (_file == INVALID_HANDLE_VALUE)
+            IE_THROW() << "Can not open file " << path << " for mapping, error: " << GetLastError();
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(_file, &fileSize)) {
+            release();
+            IE_THROW() << "Can not get size of file " << path << ", error: " << GetLastError();
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        if (_size == 0)
+            return;
+
+        // PAGE_WRITECOPY mapping shares clean pages with other processes, written pages are copied
+        const bool readOnly = mapping == WeightsMapping::ReadOnly;
+        _mapping = CreateFileMapping(_file, nullptr, readOnly ? PAGE_READONLY : PAGE_WRITECOPY, 0, 0, nullptr);
+        if (_mapping != nullptr)
+            _data = MapViewOfFile(_mapping, readOnly ? FILE_MAP_READ : FILE_MAP_COPY, 0, 0, 0);
+
+        if (_data == nullptr) {
+            auto error = GetLastError();
+            release();
+            IE_THROW() << "Can not map file " << path << ", error: " << error;
+        }
+    }
+
+    ~MMapAllocator() {
+        release();
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return (_data != nullptr && size <= _size) ? _data : nullptr;
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+};
+
+}  // namespace
+
+Blob::Ptr mapFileToBlob(const std::string& path, WeightsMapping mapping) {
+    auto allocator = std::make_shared<MMapAllocator>(path, mapping);
+    auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {allocator->size()}, Layout::C), allocator);
+    blob->allocate();
+    return blob;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -13,6 +13,7 @@
 #include <climits>
 #include <cassert>
 #include <utility>
+#include <cstdint>
 
 #include "threading/ie_thread_local.hpp"
 #include "ie_parallel_custom_arena.hpp"
@@ -24,6 +25,79 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue of tasks.
+ *        Each cell keeps a sequence number which tells producers and consumers whether the cell is free or filled
+ *        for the current lap, so enqueue and dequeue positions are claimed with a single compare-and-swap.
+ */
+class BoundedTaskQueue {
+public:
+    explicit BoundedTaskQueue(std::size_t capacity) :
+        _mask{capacity - 1},
+        _cells{new Cell[capacity]} {
+        assert((capacity & _mask) == 0 && "capacity should be a power of two");
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(Task& task) {
+        auto pos = _tail.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            auto diff = static_cast<std::intptr_t>(cell._sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell._task = std::move(task);
+                    cell._sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is full
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TryPop(Task& task) {
+        auto pos = _head.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            auto diff = static_cast<std::intptr_t>(cell._sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    task = std::move(cell._task);
+                    cell._task = nullptr;
+                    cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is empty
+            } else {
+                pos = _head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        Task                        _task;
+    };
+    static constexpr std::size_t cacheLineSize = 64;
+
+    const std::size_t           _mask;
+    std::unique_ptr<Cell[]>     _cells;
+    char                        _pad0[cacheLineSize];
+    std::atomic<std::size_t>    _head = {0};
+    char                        _pad1[cacheLineSize];
+    std::atomic<std::size_t>    _tail = {0};
+    char                        _pad2[cacheLineSize];
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -66,9 +140,7 @@ struct CPUStreamsExecutor::Impl {
                 }
             }
             _numaNodeId = _impl->_config._streams
-                ? _impl->_usedNumaNodes.at(
-                    (_streamId % _impl->_config._streams)/
-                    ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()))
+                ? _impl->GetNumaNodeId(_streamId)
                 : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             const auto concurrency = (0 == _impl->_config._threadsPerStream) ? custom::task_arena::automatic : _impl->_config._threadsPerStream;
@@ -194,33 +266,88 @@ struct CPUStreamsExecutor::Impl {
             }
         }
         #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new BoundedTaskQueue{taskQueueCapacity});
+        }
+        // threads steal tasks from the streams on the same NUMA node first
+        _victims.resize(_config._streams);
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            for (auto sameNumaNode : {true, false}) {
+                for (auto i = 1; i < _config._streams; ++i) {
+                    auto victim = (streamId + i) % _config._streams;
+                    if ((GetNumaNodeId(victim) == GetNumaNodeId(streamId)) == sameNumaNode) {
+                        _victims[streamId].push_back(victim);
+                    }
+                }
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
+                    if (Pop(streamId, task)) {
                         Execute(task, *(_streams.local()));
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    ++_sleepingThreads;
+                    _queueCondVar.wait(lock, [&] { return _pendingTasks > 0 || _isStopped; });
+                    --_sleepingThreads;
+                    if (_isStopped && _pendingTasks == 0) {
+                        break;
                     }
                 }
             });
         }
     }
 
+    int GetNumaNodeId(int streamId) const {
+        return _usedNumaNodes.at((streamId % _config._streams) /
+                                 ((_config._streams + _usedNumaNodes.size() - 1) / _usedNumaNodes.size()));
+    }
+
+    bool Pop(int streamId, Task& task) {
+        bool popped = _taskQueues[streamId]->TryPop(task);
+        for (auto it = _victims[streamId].begin(); !popped && it != _victims[streamId].end(); ++it) {
+            popped = _taskQueues[*it]->TryPop(task);
+        }
+        if (!popped && _overflowSize > 0) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            if (!_overflowQueue.empty()) {
+                task = std::move(_overflowQueue.front());
+                _overflowQueue.pop();
+                --_overflowSize;
+                popped = true;
+            }
+        }
+        if (popped) {
+            --_pendingTasks;
+        }
+        return popped;
+    }
+
     void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+        // The counter is incremented before the task becomes visible, as a worker may pop the task and decrement
+        // the counter before this thread returns from the push.
+        // Sleeping thread increments _sleepingThreads and then checks _pendingTasks under the _mutex,
+        // so either it observes the new task or the task producer observes the sleeping thread
+        ++_pendingTasks;
+        const auto numQueues = _taskQueues.size();
+        const auto first = _nextQueue.fetch_add(1, std::memory_order_relaxed);
+        bool pushed = false;
+        for (std::size_t i = 0; !pushed && i < numQueues; ++i) {
+            pushed = _taskQueues[(first + i) % numQueues]->TryPush(task);
+        }
+        if (!pushed) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            _overflowQueue.emplace(std::move(task));
+            ++_overflowSize;
+        }
+        if (_sleepingThreads > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -256,9 +383,17 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    static constexpr std::size_t            taskQueueCapacity = 256;
+    std::vector<std::unique_ptr<BoundedTaskQueue>>  _taskQueues;
+    std::vector<std::vector<int>>           _victims;
+    std::atomic<std::size_t>                _nextQueue = {0};
+    std::atomic<std::size_t>                _pendingTasks = {0};
+    std::mutex                              _overflowMutex;
+    std::queue<Task>                        _overflowQueue;
+    std::atomic<std::size_t>                _overflowSize = {0};
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    std::atomic<int>                        _sleepingThreads = {0};
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -273,6 +408,8 @@ struct CPUStreamsExecutor::Impl {
 };
 
 
+constexpr std::size_t CPUStreamsExecutor::Impl::taskQueueCapacity;
+
 int CPUStreamsExecutor::GetStreamId() {
     auto stream = _impl->_streams.local();
     return stream->_streamId;
@@ -109,6 +109,54 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION) {
+            if (val == PluginConfigParams::YES) {
+                dataflowExecution = true;
+            } else if (val == PluginConfigParams::NO) {
+                dataflowExecution = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_COUNT_HISTOGRAMS) {
+            if (val == PluginConfigParams::YES) perfCountHistograms = true;
+            else if (val == PluginConfigParams::NO) perfCountHistograms = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_HISTOGRAMS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_POOL) {
+            if (val == PluginConfigParams::NO) memoryPoolMode = MemoryPoolMode::NoPool;
+            else if (val == PluginConfigParams::YES) memoryPoolMode = MemoryPoolMode::TransparentHugePages;
+            else if (val == PluginConfigParams::CPU_MEMORY_POOL_HUGE_PAGES) memoryPoolMode = MemoryPoolMode::ExplicitHugePages;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_POOL
+                                   << ". Expected only YES/NO/" << PluginConfigParams::CPU_MEMORY_POOL_HUGE_PAGES;
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                                   << ". Expected only non-negative integer numbers";
+            shapeCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_KERNEL_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_KERNEL_CACHE_CAPACITY
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_KERNEL_CACHE_CAPACITY
+                                   << ". Expected only non-negative integer numbers";
+            kernelCacheCapacity = val_i;
+        } else if (key == PluginConfigParams::KEY_CACHE_DIR) {
+            cacheDir = val;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -148,12 +196,32 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (dataflowExecution == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, PluginConfigParams::NO });
+
+        if (perfCountHistograms == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_PERF_COUNT_HISTOGRAMS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_PERF_COUNT_HISTOGRAMS, PluginConfigParams::NO });
+
+        if (memoryPoolMode == MemoryPoolMode::TransparentHugePages)
+            _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_POOL, PluginConfigParams::YES });
+        else if (memoryPoolMode == MemoryPoolMode::ExplicitHugePages)
+            _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_POOL, PluginConfigParams::CPU_MEMORY_POOL_HUGE_PAGES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_POOL, PluginConfigParams::NO });
+
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, std::to_string(shapeCacheSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_KERNEL_CACHE_CAPACITY, std::to_string(kernelCacheCapacity) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         IE_SUPPRESS_DEPRECATED_START
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
         IE_SUPPRESS_DEPRECATED_END
+        _config.insert({ PluginConfigParams::KEY_CACHE_DIR, cacheDir });
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
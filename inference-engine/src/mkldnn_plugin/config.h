@@ -6,6 +6,7 @@
 
 #include <threading/ie_istreams_executor.hpp>
 #include "utils/debug_capabilities.h"
+#include "mkldnn_kernel_cache.hpp"
 
 #include <string>
 #include <map>
@@ -20,11 +21,24 @@ struct Config {
         On,
     };
 
+    enum MemoryPoolMode {
+        NoPool,
+        TransparentHugePages,
+        ExplicitHugePages,
+    };
+
     bool collectPerfCounters = false;
+    bool perfCountHistograms = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool dataflowExecution = false;
     std::string dumpToDot = "";
+    // set by the core when the model cache is enabled, the plugin only checks whether it's set
+    std::string cacheDir = "";
     int batchLimit = 0;
+    int shapeCacheSize = 0;
+    size_t kernelCacheCapacity = MKLDNNKernelCache::kDefaultCapacity;
+    MemoryPoolMode memoryPoolMode = MemoryPoolMode::NoPool;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
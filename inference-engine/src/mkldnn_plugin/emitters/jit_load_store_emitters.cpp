@@ -848,7 +848,7 @@ template <typename Vmm>
                     if (is_signed) {
                         h->vpmovsdw(ptr[reg + offset], vmm);  // singed int32 saturate to signed int16.
                     } else {
-                        h->vmaxsd(vmm, Vmm(aux_vec_idxs[0]), vmm);        // if singed bit is 1, set value as 0.
+                        h->vpmaxsd(vmm, vmm, Vmm(aux_vec_idxs[0]));       // if singed bit is 1, set value as 0.
                         h->vpmovusdw(ptr[reg + offset], vmm); // unsinged int32 saturate to unsigned int16.
                     }
                 } else {
@@ -859,7 +859,7 @@ template <typename Vmm>
                     if (is_signed) {
                         h->vpmovsdw(ptr[reg + offset], vmm | k_mask);
                     } else {
-                        h->vmaxsd(vmm, Vmm(aux_vec_idxs[0]), vmm);
+                        h->vpmaxsd(vmm, vmm, Vmm(aux_vec_idxs[0]));
                         h->vpmovusdw(ptr[reg + offset], vmm | k_mask);
                     }
                 }
@@ -15,3 +15,8 @@ MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEn
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
     StopAndWait();
 }
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::Cancel() {
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::Cancel();
+    _cancelRequested.store(true, std::memory_order_relaxed);
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
@@ -17,6 +18,27 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest();
+
+    void Cancel() override;
+
+    /**
+     * @brief Throws InferCancelled if the inference is canceled. Unlike ThrowIfCanceled() the state mutex is taken
+     * only if Cancel() was called after the last ResetCancelRequest(), so it may be checked often
+     */
+    void ThrowIfCancelRequested() const {
+        if (_cancelRequested.load(std::memory_order_relaxed))
+            ThrowIfCanceled();
+    }
+
+    /**
+     * @brief Forgets the Cancel() calls made before the current inference, ThrowIfCanceled() still reports them
+     */
+    void ResetCancelRequest() {
+        _cancelRequested.store(false, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<bool> _cancelRequested = {false};
 };
 
 }  // namespace MKLDNNPlugin
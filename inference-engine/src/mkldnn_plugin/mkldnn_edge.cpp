@@ -209,7 +209,7 @@ std::string MKLDNNEdge::name() {
             + "<->" + childPtr->getName() + std::to_string(child_port);
 }
 
-void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
+void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const std::string& keyPrefix) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -219,7 +219,7 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        auto ptr = weightsCache->findOrCreate(keyPrefix + name(), alloc, false);
         memoryPtr = *ptr;
         externalMemoryPtr = true;
         status = Status::Allocated;
@@ -13,6 +13,7 @@
 
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -45,7 +46,7 @@ public:
 
     void init();
     void allocate(const void* mem_ptr = nullptr);
-    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache);
+    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const std::string& keyPrefix = "");
     void reuse(MKLDNNMemoryPtr ptr);
     void validate();
     void drop();
@@ -10,16 +10,22 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "mkldnn_memory_pool.hpp"
 #include <threading/ie_executor_manager.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 #include <cstring>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/read_value.hpp>
 #include <transformations/utils/utils.hpp>
 
 using namespace MKLDNNPlugin;
@@ -35,13 +41,18 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const InferenceEngine::CNNNetwork &serializableNetwork,
+                                     bool isSerializableNetworkTransformed,
+                                     const ReshapedNetworkFactory &reshapedNetworkFactory) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
-        _network(network) {
+    _network(network),
+    _serializableNetwork(serializableNetwork),
+    _isSerializableNetworkTransformed(isSerializableNetworkTransformed) {
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
@@ -55,6 +66,18 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    if (_cfg.shapeCacheSize > 0 && reshapedNetworkFactory) {
+        if (_cfg.batchLimit > 0)
+            IE_THROW() << PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE << " can't be used together with dynamic batch";
+        // the variable states have the shapes of the network
+        if (ngraph::op::util::has_op_with_type<ngraph::op::ReadValueBase>(function))
+            IE_THROW() << PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE << " is not supported for the networks with variable states";
+        for (const auto& input : _network.getInputsInfo())
+            _networkShapes[input.first] = input.second->getTensorDesc().getDims();
+        _reshapedNetworkFactory = reshapedNetworkFactory;
+        _shapeCacheSize = static_cast<size_t>(_cfg.shapeCacheSize);
+    }
+
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
@@ -80,9 +103,27 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    if (CanReshape())
+        _shapeCaches.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
+        // Each task builds the graph of the stream it is executed on. The tasks wait until all of them are started,
+        // so every task occupies its own stream thread and all the graphs are built concurrently at load time
+        // rather than lazily on the first inference which lands on a stream with no graph yet.
+        // A shared executor of exclusive async requests may have fewer streams than graphs, so it does not wait.
+        const bool waitAllStarted = !_cfg.exclusiveAsyncRequests;
+        std::mutex startedMutex;
+        std::condition_variable startedCondVar;
+        int started = 0;
         for (auto&& task : tasks) {
-            task = [this] {
+            task = [&] {
+                if (waitAllStarted) {
+                    std::unique_lock<std::mutex> lock{startedMutex};
+                    if (++started == streams) {
+                        startedCondVar.notify_all();
+                    } else {
+                        startedCondVar.wait(lock, [&] { return started == streams; });
+                    }
+                }
                 MKLDNNExecNetwork::GetGraph();
             };
         }
@@ -122,12 +163,16 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     }
     auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
     if (!graphLock._graph.IsReady()) {
+        // the graphs of the shape cache of the stream are compiled for its NUMA node as well
+        if (CanReshape())
+            _shapeCaches[streamId % _shapeCaches.size()]._numaNodeId = numaNodeId;
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
+                    graphLock._graph.SetMemoryPool(GetMemoryPool(_cfg, numaNodeId));
                 }
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
@@ -146,6 +191,186 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+std::shared_ptr<InferenceEngine::IAllocator> MKLDNNExecNetwork::GetMemoryPool(const Config& cfg, int numaNodeId) {
+    switch (cfg.memoryPoolMode) {
+        case Config::MemoryPoolMode::TransparentHugePages:
+            return MKLDNNMemoryPool::get(numaNodeId, MKLDNNMemoryPool::HugePages::Transparent);
+        case Config::MemoryPoolMode::ExplicitHugePages:
+            return MKLDNNMemoryPool::get(numaNodeId, MKLDNNMemoryPool::HugePages::Explicit);
+        default:
+            return nullptr;
+    }
+}
+
+InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetReshapedNetwork(const InputShapes& shapes) {
+    std::lock_guard<std::mutex> lock{_reshapedNetworksMutex};
+    auto found = std::find_if(_reshapedNetworks.begin(), _reshapedNetworks.end(),
+                              [&](const std::pair<InputShapes, CNNNetwork>& network) { return network.first == shapes; });
+    if (found != _reshapedNetworks.end()) {
+        _reshapedNetworks.splice(_reshapedNetworks.begin(), _reshapedNetworks, found);
+        return found->second;
+    }
+
+    auto network = _reshapedNetworkFactory(shapes);
+    // Workaround for initializing friendly names for all the OPs, see the constructor
+    for (const auto& op : network.getFunction()->get_ops()) {
+        op->get_friendly_name();
+    }
+    _reshapedNetworks.emplace_front(shapes, network);
+    if (_reshapedNetworks.size() > _shapeCacheSize)
+        _reshapedNetworks.pop_back();
+    return network;
+}
+
+static std::string ShapesToString(const InferenceEngine::ICNNNetwork::InputShapes& shapes) {
+    std::string result;
+    for (const auto& shape : shapes) {
+        result += shape.first + ":";
+        for (auto dim : shape.second)
+            result += std::to_string(dim) + ",";
+        result += ";";
+    }
+    return result;
+}
+
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(const InputShapes& shapes) {
+    if (shapes == _networkShapes)
+        return GetGraph();
+    if (!CanReshape())
+        IE_THROW() << "Input shapes differ from the network ones, set " << PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                   << " to infer other shapes";
+
+    int streamId = 0;
+    int numaNodeId = 0;
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor) {
+        streamId = streamsExecutor->GetStreamId();
+        numaNodeId = streamsExecutor->GetNumaNodeId();
+    }
+    const size_t cacheId = streamId % _shapeCaches.size();
+    bool compiled = false;
+    auto graph = GetShapeGraph(shapes, cacheId, numaNodeId, compiled);
+    if (compiled)
+        _shapeCacheMisses++;
+    else
+        _shapeCacheHits++;
+
+    // The other streams are likely to meet the shapes soon, so the graphs of their caches are compiled in background.
+    // A task may run on any stream, so the shapes are queued to the caches and each task compiles the ones of the
+    // caches of its NUMA node. The shapes left to the other nodes are compiled by their streams on demand
+    if (compiled && _shapeCaches.size() > 1) {
+        for (size_t i = 0; i < _shapeCaches.size(); i++) {
+            if (i == cacheId)
+                continue;
+            std::lock_guard<std::mutex> lock{_shapeCaches[i]._mutex};
+            auto& pendingShapes = _shapeCaches[i]._pendingShapes;
+            pendingShapes.push_back(shapes);
+            // the cache would evict the older ones anyway
+            if (pendingShapes.size() > _shapeCacheSize)
+                pendingShapes.pop_front();
+        }
+        std::weak_ptr<MKLDNNExecNetwork> weakThis = std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this());
+        for (size_t i = 1; i < _shapeCaches.size(); i++) {
+            _taskExecutor->run([weakThis] {
+                if (auto execNetwork = weakThis.lock())
+                    execNetwork->CompilePendingShapes();
+            });
+        }
+    }
+    return Graph::Lock(graph);
+}
+
+std::shared_ptr<MKLDNNExecNetwork::Graph> MKLDNNExecNetwork::GetShapeGraph(const InputShapes& shapes, size_t cacheId,
+                                                                         int numaNodeId, bool& compiled) {
+    auto& cache = _shapeCaches[cacheId];
+    auto findGraph = [&] {
+        auto found = std::find_if(cache._graphs.begin(), cache._graphs.end(),
+                                  [&](const std::pair<InputShapes, std::shared_ptr<Graph>>& graph) { return graph.first == shapes; });
+        if (found == cache._graphs.end())
+            return std::shared_ptr<Graph>{};
+        cache._graphs.splice(cache._graphs.begin(), cache._graphs, found);
+        return found->second;
+    };
+
+    std::shared_ptr<Graph> graph;
+    {
+        std::lock_guard<std::mutex> lock{cache._mutex};
+        graph = findGraph();
+    }
+    if (graph)
+        return graph;
+
+    // the graph is compiled without the cache lock, so the other shapes of the stream are not blocked
+    graph = std::make_shared<Graph>();
+    std::exception_ptr exception;
+    auto makeGraph = [&] {
+        try {
+            auto network = GetReshapedNetwork(shapes);
+            {
+                std::lock_guard<std::mutex> lock{_cfgMutex};
+                graph->setConfig(_cfg);
+                graph->SetMemoryPool(GetMemoryPool(_cfg, numaNodeId));
+            }
+            // the constants computed by the graph may depend on the shapes, while the node names are the same
+            graph->SetConstantsCacheScope(ShapesToString(shapes));
+            graph->CreateGraph(network, extensionManager, _numaNodesWeights[numaNodeId]);
+        } catch(...) {
+            exception = std::current_exception();
+        }
+    };
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor) {
+        streamsExecutor->Execute(makeGraph);
+    } else {
+        makeGraph();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+    std::lock_guard<std::mutex> lock{cache._mutex};
+    // the same shapes may be compiled concurrently by the other request of the stream or in background
+    auto found = findGraph();
+    if (found)
+        return found;
+    cache._graphs.emplace_front(shapes, graph);
+    if (cache._graphs.size() > _shapeCacheSize)
+        cache._graphs.pop_back();
+    compiled = true;
+    return graph;
+}
+
+void MKLDNNExecNetwork::CompilePendingShapes() {
+    int streamId = 0;
+    int numaNodeId = 0;
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor) {
+        streamId = streamsExecutor->GetStreamId();
+        numaNodeId = streamsExecutor->GetNumaNodeId();
+    }
+    for (size_t i = 0; i < _shapeCaches.size(); i++) {
+        const size_t cacheId = (streamId + i) % _shapeCaches.size();
+        auto& cache = _shapeCaches[cacheId];
+        if (cache._numaNodeId != numaNodeId)
+            continue;
+        InputShapes shapes;
+        {
+            std::lock_guard<std::mutex> lock{cache._mutex};
+            if (cache._pendingShapes.empty())
+                continue;
+            shapes = std::move(cache._pendingShapes.front());
+            cache._pendingShapes.pop_front();
+        }
+        try {
+            bool compiled = false;
+            GetShapeGraph(shapes, cacheId, numaNodeId, compiled);
+        } catch (...) {
+            // the inference of the shapes reports the error
+        }
+        return;
+    }
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -195,6 +420,10 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_SHAPE_CACHE_HITS));
+        metrics.push_back(METRIC_KEY(CPU_SHAPE_CACHE_MISSES));
+        metrics.push_back(METRIC_KEY(CPU_PERF_COUNT_HISTOGRAMS_JSON));
+        metrics.push_back(METRIC_KEY(CPU_PERF_COUNT_HISTOGRAMS_CSV));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -209,11 +438,43 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_SHAPE_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(CPU_SHAPE_CACHE_HITS, static_cast<uint64_t>(_shapeCacheHits));
+    } else if (name == METRIC_KEY(CPU_SHAPE_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(CPU_SHAPE_CACHE_MISSES, static_cast<uint64_t>(_shapeCacheMisses));
+    } else if (name == METRIC_KEY(CPU_PERF_COUNT_HISTOGRAMS_JSON)) {
+        IE_SET_METRIC_RETURN(CPU_PERF_COUNT_HISTOGRAMS_JSON, PerfReportToJson(GetPerfReport()));
+    } else if (name == METRIC_KEY(CPU_PERF_COUNT_HISTOGRAMS_CSV)) {
+        IE_SET_METRIC_RETURN(CPU_PERF_COUNT_HISTOGRAMS_CSV, PerfReportToCsv(GetPerfReport()));
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
 }
 
+PerfReport MKLDNNExecNetwork::GetPerfReport() const {
+    PerfReport report;
+    for (auto& g : _graphs) {
+        auto graphLock = Graph::Lock(const_cast<Graph&>(g));
+        if (graphLock._graph.IsReady())
+            graphLock._graph.GetPerfReport(report);
+    }
+    // the graphs of the other input shapes have the same node names, so their histograms are merged as well
+    for (auto& cache : _shapeCaches) {
+        std::vector<std::shared_ptr<Graph>> graphs;
+        {
+            std::lock_guard<std::mutex> lock{const_cast<ShapeCache&>(cache)._mutex};
+            for (const auto& graph : cache._graphs)
+                graphs.push_back(graph.second);
+        }
+        for (const auto& graph : graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (graphLock._graph.IsReady())
+                graphLock._graph.GetPerfReport(report);
+        }
+    }
+    return report;
+}
+
 bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const {
     InputsDataMap inputs = network.getInputsInfo();
 
@@ -261,6 +522,12 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
     return true;
 }
 
+void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::Export");
+    CNNNetworkSerializer serializer(modelStream, _isSerializableNetworkTransformed);
+    serializer << _serializableNetwork;
+}
+
 IE_SUPPRESS_DEPRECATED_START
 std::vector<IVariableStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
     return memoryStates;
@@ -11,11 +11,15 @@
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <atomic>
+#include <functional>
+#include <list>
 #include <vector>
 #include <memory>
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -23,6 +27,11 @@ class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefa
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
 
+    /**
+     * Creates the network transformed up to CPU specific opset for the input shapes other than the network ones
+     */
+    using ReshapedNetworkFactory = std::function<InferenceEngine::CNNNetwork(const InferenceEngine::ICNNNetwork::InputShapes&)>;
+
     std::shared_ptr<InferenceEngine::IInferRequestInternal>
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                            InferenceEngine::OutputsDataMap networkOutputs) override;
@@ -30,7 +39,9 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const InferenceEngine::CNNNetwork &serializableNetwork, bool isSerializableNetworkTransformed,
+                      const ReshapedNetworkFactory &reshapedNetworkFactory = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -40,6 +51,14 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    /**
+     * Writes the IR cache of the network: the IR after the common transformations and the inputs/outputs info.
+     * The IR is the transformed one only if the network was loaded with the model cache enabled, otherwise it's
+     * the original network. The compiled graph isn't stored, ImportNetwork() compiles it again: a format of the
+     * compiled graph (primitive descriptors, fused topology, memory offsets and reordered weights) is not implemented
+     */
+    void Export(std::ostream& modelStream) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -48,6 +67,9 @@ protected:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     const InferenceEngine::CNNNetwork           _network;
+    // network to be stored in the IR cache by Export(): either transformed up to CPU specific opset or the original one
+    const InferenceEngine::CNNNetwork           _serializableNetwork;
+    const bool                                  _isSerializableNetworkTransformed;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
@@ -56,19 +78,76 @@ protected:
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
+            // keeps the graph alive while it is locked, even if it is evicted from the shape cache
+            explicit Lock(const std::shared_ptr<Graph>& graph) : Lock(*graph) { _holder = graph; }
+            Lock(Lock&&) = default;
+            ~Lock() {
+                if (owns_lock())
+                    unlock();
+            }
             Graph&                          _graph;
+            std::shared_ptr<Graph>          _holder;
         };
     };
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
 
+    using InputShapes = InferenceEngine::ICNNNetwork::InputShapes;
+    // Graphs compiled for the input shapes other than the network ones, the most recently used first
+    struct ShapeCache {
+        std::mutex                                              _mutex;
+        std::list<std::pair<InputShapes, std::shared_ptr<Graph>>> _graphs;
+        // NUMA node of the stream, the graphs compiled in background for the stream use its weights and memory pool
+        std::atomic<int>                                        _numaNodeId = {0};
+        // shapes met by the other streams, they are compiled in background by a stream of the NUMA node
+        std::list<InputShapes>                                  _pendingShapes;
+    };
+    // one cache per graph of _graphs
+    std::deque<ShapeCache>                      _shapeCaches;
+    // empty if the shape cache is disabled
+    ReshapedNetworkFactory                      _reshapedNetworkFactory;
+    size_t                                      _shapeCacheSize = 0;
+    InputShapes                                 _networkShapes;
+    // networks transformed for the cached shapes, they are shared by the streams
+    std::mutex                                  _reshapedNetworksMutex;
+    std::list<std::pair<InputShapes, InferenceEngine::CNNNetwork>> _reshapedNetworks;
+    std::atomic<uint64_t>                       _shapeCacheHits = {0};
+    std::atomic<uint64_t>                       _shapeCacheMisses = {0};
+
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
     Graph::Lock GetGraph();
 
+    /* Gets the graph compiled for the input shapes in current stream, compiles it on a miss of the shape cache and
+     * submits the compilation of the graphs of the shapes to the caches of all the other streams in background.
+     * The network shapes give the graph of GetGraph().
+     */
+    Graph::Lock GetGraph(const InputShapes& shapes);
+
+    /* Gets the graph of the input shapes from the shape cache, compiles it for the NUMA node on a miss.
+     * compiled is set if the graph was compiled and inserted by this call, it doesn't affect the hit/miss metrics
+     */
+    std::shared_ptr<Graph> GetShapeGraph(const InputShapes& shapes, size_t cacheId, int numaNodeId, bool& compiled);
+
+    /* Compiles one of the pending shapes of the caches of the current NUMA node, the cache of the current stream first.
+     * So the graphs compiled in background are allocated and first touched on the NUMA node of the stream using them
+     */
+    void CompilePendingShapes();
+
+    bool CanReshape() const { return _reshapedNetworkFactory != nullptr; }
+
+    InferenceEngine::CNNNetwork GetReshapedNetwork(const InputShapes& shapes);
+
+    /* Gets the process wide memory pool of the NUMA node, nullptr if the pool is disabled */
+    static std::shared_ptr<InferenceEngine::IAllocator> GetMemoryPool(const Config& cfg, int numaNodeId);
+
+    /* Merges the node execution time histograms of the graphs of all the streams including the graphs of the shape cache,
+     * waits for their inferences. The graphs evicted from the shape cache are not reported */
+    PerfReport GetPerfReport() const;
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
 
@@ -13,6 +13,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <functional>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -27,6 +28,7 @@
 #include <nodes/mkldnn_convert_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -47,6 +49,10 @@
 #include <transformations/utils/utils.hpp>
 #include <low_precision/transformer.hpp>
 
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/task_group.h>
+#endif
+
 /*****************************************************
  * Debug capability
  *  - PRINT_GRAPH_INFO : Define it to enable printing
@@ -74,7 +80,7 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
     if (IsReady())
         ForgetGraphData();
     // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    weightsCache = config.streamExecutorConfig._streams != 1 || !constantsCacheScope.empty() ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -304,7 +310,8 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
         }
     }
 
-    // Loading mean images
+    // Loading mean images. The plugin inserts the preprocessing to the network as operations,
+    // so they are left only in the networks exported in the transformed form before
     for (const auto& input : inputsInfo) {
         MKLDNNDims outDims;
         if (!inputNodesMap[input.first]->getChildEdgeAt(0)->getDims().ndims()) {
@@ -348,6 +355,29 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
     ExecuteConstantNodesOnly();
+
+    InitExecutableNodes();
+    InitDataflow();
+    InitPerfDetails();
+}
+
+void MKLDNNGraph::InitPerfDetails() {
+    if (!config.perfCountHistograms)
+        return;
+    for (auto &node : graphNodes)
+        node->PerfCounter().enableDetails();
+}
+
+void MKLDNNGraph::InitExecutableNodes() {
+    executableNodes.clear();
+    variantExecutableNodes.clear();
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        if (graphNodes[i]->isConstant())
+            continue;
+        executableNodes.push_back(graphNodes[i].get());
+        if (invariantNodes.empty() || !invariantNodes[i])
+            variantExecutableNodes.push_back(graphNodes[i].get());
+    }
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -405,7 +435,7 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
             auto edgePtr = graphNode->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
+                    auto ptr = weightsCache->get(constantsCacheScope + edgePtr->name());
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -560,9 +590,59 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     return edge_clusters;
 }
 
+// Loop invariant nodes depend only on the invariant inputs and the constants. A node writing to the memory shared
+// in-place with the output of a node depending on the iteration makes it to be executed every iteration as well
+static std::vector<bool> findInvariantNodes(const std::vector<MKLDNNNodePtr>& graphNodes, const std::set<std::string>& invariantInputs,
+                                            const edge_clusters_t& edge_clusters) {
+    std::vector<bool> invariant(graphNodes.size(), false);
+    if (invariantInputs.empty())
+        return invariant;
+
+    std::vector<bool> demoted(graphNodes.size(), false);
+    bool changed = true;
+    while (changed) {
+        for (auto &node : graphNodes) {
+            bool isInvariant = false;
+            if (node->getType() == Input) {
+                isInvariant = invariantInputs.count(node->getName()) != 0;
+            } else if (!demoted[node->getExecIndex()] && !node->isConstant() && !node->getParentEdges().empty() &&
+                       !one_of(node->getType(), Output, MemoryInput, MemoryOutput)) {
+                isInvariant = true;
+                for (size_t i = 0; isInvariant && i < node->getParentEdges().size(); i++) {
+                    auto parent = node->getParentEdgeAt(i)->getParent();
+                    isInvariant = invariant[parent->getExecIndex()] || parent->isConstant();
+                }
+            }
+            invariant[node->getExecIndex()] = isInvariant;
+        }
+
+        changed = false;
+        for (auto &cluster : edge_clusters) {
+            bool hasVariantWriter = false;
+            for (auto &edge : cluster) {
+                auto parent = edge->getParent();
+                hasVariantWriter |= !invariant[parent->getExecIndex()] && !parent->isConstant();
+            }
+            if (!hasVariantWriter)
+                continue;
+            for (auto &edge : cluster) {
+                auto parent = edge->getParent();
+                if (invariant[parent->getExecIndex()] && parent->getType() != Input) {
+                    demoted[parent->getExecIndex()] = true;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    return invariant;
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
+    invariantNodes = findInvariantNodes(graphNodes, invariantInputs, edge_clusters);
+
     size_t edge_clusters_count = edge_clusters.size();
 
     for (size_t i = 0; i < edge_clusters_count;) {
@@ -575,7 +655,7 @@ void MKLDNNGraph::AllocateWithReuse() {
                     auto constNode = std::static_pointer_cast<MKLDNNInputNode>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<MKLDNNMemory>(constNode->getMemoryPtr()));
                 } else {
-                    edge->externalAllocate(weightsCache);
+                    edge->externalAllocate(weightsCache, constantsCacheScope);
                 }
                 erase = true;
             }
@@ -626,11 +706,12 @@ void MKLDNNGraph::AllocateWithReuse() {
         // Constant data are filled once on load.
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
-        bool isConst = false, isOutput = false, isInput = false;
+        bool isConst = false, isOutput = false, isInput = false, isInvariantOutput = false;
         for (auto &edge : edge_clusters[i]) {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Output;
             isInput  |= edge->getParent()->getType() == Input;
+            isInvariantOutput |= isInvariant(edge->getParent()) && !isInvariant(edge->getChild());
         }
 
         if (reuse_io_tensors) {
@@ -643,6 +724,12 @@ void MKLDNNGraph::AllocateWithReuse() {
             }
         }
 
+        // The invariant nodes are skipped by the next iterations, so their outputs must survive them
+        if (isInvariantOutput) {
+            box.start = 0;
+            box.finish = -1;
+        }
+
         box.size = div_up(box.size, alignment);
     }
 
@@ -650,7 +737,17 @@ void MKLDNNGraph::AllocateWithReuse() {
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    if (memoryPool && total_size > 0) {
+        auto pool = memoryPool;
+        void* block = pool->alloc(total_size);
+        if (block == nullptr)
+            IE_THROW() << "Failed to allocate the graph workspace of " << total_size << " bytes";
+        memWorkspaceBlock = std::shared_ptr<void>(block, [pool](void* ptr) { pool->free(ptr); });
+        memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)), block);
+    } else {
+        memWorkspaceBlock.reset();
+        memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    }
 
     if (edge_clusters.empty())
         return;
@@ -677,6 +774,39 @@ void MKLDNNGraph::AllocateWithReuse() {
         }
         IE_ASSERT(count == 1);
     }
+
+    if (config.dataflowExecution) {
+        // Clusters placed at overlapping addresses have disjoint lifetimes in terms of execIndex.
+        // For the dataflow execution every node touching the earlier cluster must complete
+        // before any node touching the later one is started
+        std::vector<std::vector<size_t>> clusterNodes(edge_clusters.size());
+        for (int i = 0; i < edge_clusters.size(); i++) {
+            for (auto &edge : edge_clusters[i]) {
+                clusterNodes[i].push_back(edge->getParent()->execIndex);
+                clusterNodes[i].push_back(edge->getChild()->execIndex);
+            }
+        }
+
+        dataflowDependents.assign(graphNodes.size(), {});
+        for (int i = 0; i < edge_clusters.size(); i++) {
+            const int64_t i_begin = memSolver.getOffset(i), i_end = i_begin + boxes[i].size;
+            for (int j = i + 1; j < edge_clusters.size(); j++) {
+                const int64_t j_begin = memSolver.getOffset(j), j_end = j_begin + boxes[j].size;
+                if (i_end <= j_begin || j_end <= i_begin)
+                    continue;
+
+                bool iFirst = boxes[i].finish < boxes[j].start;
+                const auto &first = iFirst ? clusterNodes[i] : clusterNodes[j];
+                const auto &second = iFirst ? clusterNodes[j] : clusterNodes[i];
+                for (auto from : first) {
+                    for (auto to : second) {
+                        if (from < to)
+                            dataflowDependents[from].push_back(to);
+                    }
+                }
+            }
+        }
+    }
 }
 
 void MKLDNNGraph::Allocate() {
@@ -801,36 +931,202 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
     }
 }
 
+namespace {
+
+// cancellation is checked once per the nodes period, the check takes no lock until Cancel() is called
+constexpr size_t cancelCheckPeriod = 16;
+
+template <bool collectPerfCounters>
+void executeNodes(const std::vector<MKLDNNNode*>& nodes, mkldnn::stream& stream, const MKLDNNInferRequest* request) {
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (request != nullptr && i % cancelCheckPeriod == 0)
+            request->ThrowIfCancelRequested();
+
+        MKLDNNNode* node = nodes[i];
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->perfCounters().execute);
+        if (collectPerfCounters) {
+            PERF(node);
+            node->execute(stream);
+        } else {
+            node->execute(stream);
+        }
+    }
+}
+
+}  // namespace
+
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
+    if (!dataflowDependenciesCount.empty()) {
+        if (batch > 0) {
+            for (auto &node : graphNodes)
+                node->setDynamicBatchLim(batch);
+        }
+        if (config.collectPerfCounters) {
+            InferDataflow<true>(request);
+        } else {
+            InferDataflow<false>(request);
+        }
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+
     mkldnn::stream stream(eng);
 
-    ENABLE_CPU_DEBUG_CAP(NodeDumper nd(config.debugCaps, infer_count));
+    if (batch > 0) {
+        for (auto &node : graphNodes)
+            node->setDynamicBatchLim(batch);
+    }
+
+#ifndef CPU_DEBUG_CAPS
+    // the per node branches are resolved once per inference
+    const auto& nodes = infer_count > 0 ? variantExecutableNodes : executableNodes;
+    if (config.collectPerfCounters) {
+        executeNodes<true>(nodes, stream, request);
+    } else {
+        executeNodes<false>(nodes, stream, request);
+    }
+#else
+    if (config.collectPerfCounters) {
+        InferWithDumps<true>(stream, request);
+    } else {
+        InferWithDumps<false>(stream, request);
+    }
+#endif
+
+    if (infer_count != -1) infer_count++;
+}
+
+#ifdef CPU_DEBUG_CAPS
+template <bool collectPerfCounters>
+void MKLDNNGraph::InferWithDumps(mkldnn::stream& stream, MKLDNNInferRequest* request) {
+    // the dumps cover the constant nodes as well
+    NodeDumper nd(config.debugCaps, infer_count);
 
     for (int i = 0; i < graphNodes.size(); i++) {
         if (request != nullptr) {
-            request->ThrowIfCanceled();
+            request->ThrowIfCancelRequested();
+        }
+
+        auto execute = [&]() {
+            nd.dumpInputBlobs(graphNodes[i]);
+
+            if (!graphNodes[i]->isConstant() && !(infer_count > 0 && invariantNodes[i])) {
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
+                graphNodes[i]->execute(stream);
+            }
+
+            nd.dumpOutputBlobs(graphNodes[i]);
+        };
+        if (collectPerfCounters) {
+            PERF(graphNodes[i]);
+            execute();
+        } else {
+            execute();
         }
+    }
+}
+#endif
 
-        PERF(graphNodes[i]);
+void MKLDNNGraph::InitDataflow() {
+    // Dataflow execution relies on the TBB task scheduler. Per node dumps of the debug capabilities
+    // expect the sequential order, so the nodes are executed one by one in such builds
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO) && !defined(CPU_DEBUG_CAPS)
+    if (!config.dataflowExecution || graphNodes.size() < 2) {
+        dataflowDependents.clear();
+        return;
+    }
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitDataflow");
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+    // memory reuse constraints are collected by AllocateWithReuse
+    dataflowDependents.resize(graphNodes.size());
 
-        ENABLE_CPU_DEBUG_CAP(nd.dumpInputBlobs(graphNodes[i]));
+    std::vector<size_t> memoryInputs;
+    for (auto &node : graphNodes) {
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            dataflowDependents[node->execIndex].push_back(node->getChildEdgeAt(i)->getChild()->execIndex);
+        }
+        if (node->getType() == MemoryInput)
+            memoryInputs.push_back(node->execIndex);
+    }
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+    // MemoryOutput stores the state which is read by MemoryInput, so it waits for all the state readers
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryOutput) {
+            for (auto input : memoryInputs)
+                dataflowDependents[input].push_back(node->execIndex);
         }
+    }
 
-        ENABLE_CPU_DEBUG_CAP(nd.dumpOutputBlobs(graphNodes[i]));
+    dataflowDependenciesCount.assign(graphNodes.size(), 0);
+    for (auto &dependents : dataflowDependents) {
+        std::sort(dependents.begin(), dependents.end());
+        dependents.erase(std::unique(dependents.begin(), dependents.end()), dependents.end());
+        for (auto dependent : dependents)
+            dataflowDependenciesCount[dependent]++;
     }
+    dataflowPending.reset(new std::atomic<size_t>[graphNodes.size()]);
+#else
+    dataflowDependents.clear();
+#endif
+}
 
-    if (infer_count != -1) infer_count++;
+template <bool collectPerfCounters>
+void MKLDNNGraph::InferDataflow(MKLDNNInferRequest* request) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    for (size_t i = 0; i < graphNodes.size(); i++)
+        dataflowPending[i] = dataflowDependenciesCount[i];
+
+    tbb::task_group taskGroup;
+    std::function<void(size_t)> executeFrom = [&](size_t idx) {
+        // the ready dependent found first is executed by the same thread, the rest ones are spawned
+        while (idx != graphNodes.size()) {
+            if (request != nullptr) {
+                request->ThrowIfCancelRequested();
+            }
+
+            auto &node = graphNodes[idx];
+            if (!node->isConstant() && !(infer_count > 0 && invariantNodes[idx])) {
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+                // isolation prevents the node's internal parallel loops from picking up
+                // other nodes' tasks which would share the oneDNN per thread scratchpad
+                auto execute = [&] {
+                    tbb::this_task_arena::isolate([&] {
+                        mkldnn::stream stream(eng);
+                        node->execute(stream);
+                    });
+                };
+                if (collectPerfCounters) {
+                    PERF(node);
+                    execute();
+                } else {
+                    execute();
+                }
+            }
+
+            size_t next = graphNodes.size();
+            for (auto dependent : dataflowDependents[idx]) {
+                if (--dataflowPending[dependent] == 0) {
+                    if (next == graphNodes.size()) {
+                        next = dependent;
+                    } else {
+                        taskGroup.run([&executeFrom, dependent] { executeFrom(dependent); });
+                    }
+                }
+            }
+            idx = next;
+        }
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        if (dataflowDependenciesCount[i] == 0)
+            taskGroup.run([&executeFrom, i] { executeFrom(i); });
+    }
+    taskGroup.wait();
+#endif
 }
 
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
@@ -949,6 +1245,18 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     }
 }
 
+void MKLDNNGraph::GetPerfReport(PerfReport &report) const {
+    for (const auto &node : graphNodes) {
+        const auto details = node->PerfCounter().getDetails();
+        if (details == nullptr || details->histogram.count() == 0)
+            continue;
+        auto &nodeReport = report[node->getName()];
+        nodeReport.layerType = node->typeStr;
+        nodeReport.execType = node->getPrimitiveDescriptorType();
+        nodeReport.details.merge(*details);
+    }
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -959,6 +1267,7 @@ const Config& MKLDNNGraph::getConfig() const {
 
 void MKLDNNGraph::setProperty(const std::map<std::string, std::string>& properties) {
     config.readProperties(properties);
+    InitPerfDetails();
 }
 
 Config MKLDNNGraph::getProperty() const {
@@ -11,6 +11,7 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 #include <memory>
@@ -61,6 +62,44 @@ public:
 
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
 
+    /**
+     * @brief Sets the names of the inputs which keep the same data during the iterations of a loop body.
+     * The nodes depending only on such inputs and the constants are executed by the first Infer() after ResetInferCount(),
+     * the next calls reuse their outputs, so the memory of these outputs is never shared with other tensors.
+     * Must be called before CreateGraph().
+     * @param names
+     * names of the invariant inputs
+     */
+    void SetInvariantInputs(const std::set<std::string>& names) {
+        invariantInputs = names;
+    }
+
+    /**
+     * @brief Sets the prefix of the weights cache keys of the constant tensors computed by the graph and enables
+     * the weights cache even for the single stream. The graphs of the network reshaped to different input shapes
+     * have the same node names, while the computed constants may differ. Must be called before CreateGraph().
+     * @param scope
+     * prefix of the keys, empty for the graphs of the network shapes
+     */
+    void SetConstantsCacheScope(const std::string& scope) {
+        constantsCacheScope = scope;
+    }
+
+    /**
+     * @brief Sets the allocator of the memory workspace, the heap is used if it is not set.
+     * Must be called before CreateGraph().
+     * @param pool
+     * allocator of the workspace, nullptr for the heap
+     */
+    void SetMemoryPool(const std::shared_ptr<InferenceEngine::IAllocator>& pool) {
+        memoryPool = pool;
+    }
+
+    bool isInvariant(const MKLDNNNodePtr& node) const {
+        const int idx = node->getExecIndex();
+        return idx >= 0 && static_cast<size_t>(idx) < invariantNodes.size() && invariantNodes[idx];
+    }
+
     const std::vector<MKLDNNNodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -98,6 +137,8 @@ public:
     }
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+    // merges the execution time histograms of the nodes to the report
+    void GetPerfReport(PerfReport &report) const;
 
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
@@ -182,24 +223,48 @@ protected:
         outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
+        invariantNodes.clear();
+        executableNodes.clear();
+        variantExecutableNodes.clear();
+        dataflowDependents.clear();
+        dataflowDependenciesCount.clear();
         _normalizePreprocMap.clear();
     }
     Status status { NotReady };
     Config config;
 
-    // For dumping purposes. -1 - no counting, all other positive
+    // For dumping purposes and skipping of the invariant nodes. -1 - no counting, all other positive
     // values mean increment it within each Infer() call
     int infer_count = -1;
 
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    std::shared_ptr<InferenceEngine::IAllocator> memoryPool;
+    // returns the workspace to the pool
+    std::shared_ptr<void> memWorkspaceBlock;
 
     std::map<std::string, MKLDNNNodePtr> inputNodesMap;
     std::map<std::string, MKLDNNNodePtr> outputNodesMap;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
+    // Loop body: the invariant inputs and, by execIndex, the nodes executed by the first iteration only
+    std::set<std::string> invariantInputs;
+    std::vector<bool> invariantNodes;
+
+    std::string constantsCacheScope;
+
+    // Non-constant nodes in the execution order, all of them and without the invariant ones
+    std::vector<MKLDNNNode*> executableNodes;
+    std::vector<MKLDNNNode*> variantExecutableNodes;
+
+    // Dataflow execution: for each node (by execIndex) the nodes which can be executed only after it
+    // and the number of nodes it waits for. Empty if the nodes are executed sequentially
+    std::vector<std::vector<size_t>> dataflowDependents;
+    std::vector<size_t> dataflowDependenciesCount;
+    std::unique_ptr<std::atomic<size_t>[]> dataflowPending;
+
     std::map<std::string, NormalizePreprocess> _normalizePreprocMap;
     std::string _name;
 
@@ -218,6 +283,14 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
+    void InitExecutableNodes();
+    void InitPerfDetails();
+    void InitDataflow();
+    // the perf counters branch is resolved once per inference, not per node
+    template <bool collectPerfCounters>
+    void InferDataflow(MKLDNNInferRequest* request);
+    template <bool collectPerfCounters>
+    void InferWithDumps(mkldnn::stream& stream, MKLDNNInferRequest* request);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
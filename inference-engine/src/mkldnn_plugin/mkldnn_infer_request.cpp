@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_set>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -34,6 +35,12 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    reshapable = execNetwork->CanReshape();
+    {
+        // the request may be executed by any stream, so its blobs have no NUMA preference
+        std::lock_guard<std::mutex> lock{execNetwork->_cfgMutex};
+        memoryPool = MKLDNNExecNetwork::GetMemoryPool(execNetwork->_cfg, -1);
+    }
 
     // Allocate all input blobs
     for (const auto& it : _networkInputs) {
@@ -67,6 +74,9 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         memoryStates = execNetwork->QueryState();
     }
     IE_SUPPRESS_DEPRECATED_END
+
+    if (!memoryStates.empty())
+        GetStateBindings();
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
@@ -82,9 +92,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
 
     InferenceEngine::Blob::Ptr iconv;
     if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
-                                         inputBlob->getTensorDesc().getLayout()));
-        iconv->allocate();
+        iconv = allocateBlob(InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
+                                                         inputBlob->getTensorDesc().getLayout()));
         if (inputBlob->size() != iconv->size())
             IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
                                << iconv->size();
@@ -126,51 +135,67 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+const MKLDNNPlugin::MKLDNNInferRequest::StateBindings& MKLDNNPlugin::MKLDNNInferRequest::GetStateBindings() {
+    auto found = stateBindings.find(graph);
+    if (found != stateBindings.end())
+        return found->second;
 
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
-        }
+    std::unordered_set<std::string> updatedIds;
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == MemoryOutput)
+            updatedIds.insert(dynamic_cast<MKLDNNMemoryNode*>(node.get())->getId());
     }
-}
 
-void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
+    auto& bindings = stateBindings[graph];
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
             auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+            // Remove suffix with pair ID. Internal information.
+            auto state_name = cur_id.substr(0, cur_id.find("/id="));
+            for (const auto& state : memoryStates) {
+                if (state->GetName() == state_name) {
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    IE_ASSERT(cur_state != nullptr);
+                    bindings.push_back({cur_node, cur_state.get(), updatedIds.count(cur_id) != 0});
                 }
             }
         }
     }
+    return bindings;
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+    stateBindingsCurrent = &GetStateBindings();
+    for (const auto& binding : *stateBindingsCurrent) {
+        auto current = binding.state->GetCurrentData();
+        binding.node->bindState(current, binding.updated ? binding.state->GetNextData() : current);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
+    for (const auto& binding : *stateBindingsCurrent) {
+        if (binding.updated)
+            binding.state->SwapBuffers();
+    }
+}
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    auto graphLock = reshapable ? execNetwork->GetGraph(getInputShapes()) : execNetwork->GetGraph();
+    if (reshapable && graph != &(graphLock._graph)) {
+        graph = &(graphLock._graph);
+        graphHolder = graphLock._holder;
+        redirectBlobs();
+    }
     graph = &(graphLock._graph);
 
+    // Cancel() calls made before are reported by ThrowIfCanceled() as the request state is still canceled
+    if (_asyncRequest != nullptr) {
+        _asyncRequest->ResetCancelRequest();
+    }
     ThrowIfCanceled();
 
     execDataPreprocessing(_inputs);
@@ -233,15 +258,14 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 desc = InferenceEngine::TensorDesc(p, dims, l);
             }
 
-            _inputs[name] = make_blob_with_precision(desc);
-            _inputs[name]->allocate();
+            _inputs[name] = allocateBlob(desc);
             if (blobs[name]->getTensorDesc() == desc &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = _inputs[name]->buffer();
             }
         }
         data = _inputs[name];
-        checkBlob(data, name, true);
+        checkBlob(data, name, true, reshapable ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
         // check if preprocess required, but still wasn't set
         auto preProcessedInput = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
             [&](const std::pair<std::string, InferenceEngine::InputInfo::Ptr>& pair)
@@ -272,8 +296,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
                 desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-                data = make_blob_with_precision(desc);
-                data->allocate();
+                data = allocateBlob(desc);
             } else {
                 const auto& expectedTensorDesc = blobs[name]->getTensorDesc();
 
@@ -300,7 +323,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             }
         }
         data = _outputs[name];
-        checkBlob(data, name, false);
+        checkBlob(data, name, false, reshapable ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
     }
     if (!data) {
         IE_THROW() << "Cannot find blob with name: " << name;
@@ -348,6 +371,16 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // Stores the given blob as ROI blob. It will be used to fill in network input during
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
+        } else if (reshapable) {
+            // the graph of the blob shape is taken from the shape cache
+            if (foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                IE_THROW(ParameterMismatch) << "Failed to set input blob. Rank mismatch.";
+            }
+
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundInput->getTensorDesc().getBlockingDesc().getOrder() != data->getTensorDesc().getBlockingDesc().getOrder()) {
+                IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+            }
         } else {
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
@@ -365,7 +398,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
                 foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
                 IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
             }
+        }
 
+        if (!preProcRequired) {
             InferenceEngine::BlobMap blobs;
             graph->getInputBlobs(blobs);
             if (blobs.find(name) == blobs.end())
@@ -389,19 +424,30 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             IE_THROW(ParameterMismatch) << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            IE_THROW() << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
-        }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+        if (reshapable) {
+            // the blob is reallocated by the inference if it doesn't match the shape of the result
+            if (foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output Blob. Rank mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc().getOrder() != data->getTensorDesc().getBlockingDesc().getOrder()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
+        } else {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                IE_THROW() << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
         }
 
         InferenceEngine::BlobMap blobs;
@@ -496,6 +542,63 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
 }
 
 
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::allocateBlob(const InferenceEngine::TensorDesc& desc) {
+    auto blob = memoryPool ? make_blob_with_precision(desc, memoryPool) : make_blob_with_precision(desc);
+    blob->allocate();
+    return blob;
+}
+
+InferenceEngine::ICNNNetwork::InputShapes MKLDNNPlugin::MKLDNNInferRequest::getInputShapes() const {
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    for (const auto& input : _inputs)
+        shapes[input.first] = input.second->getTensorDesc().getDims();
+    return shapes;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::redirectBlobs() {
+    // The graph of other shapes is used, so the user buffers are bound to its edges again
+    // and the output blobs are reallocated for the shapes of its results
+    InferenceEngine::BlobMap graphInputs, graphOutputs;
+    graph->getInputBlobs(graphInputs);
+    graph->getOutputBlobs(graphOutputs);
+
+    externalPtr.clear();
+    for (const auto& input : _inputs) {
+        auto graphInput = graphInputs.find(input.first);
+        if (graphInput != graphInputs.end() && input.second->getTensorDesc() == graphInput->second->getTensorDesc() &&
+            graph->_normalizePreprocMap.find(input.first) == graph->_normalizePreprocMap.end()) {
+            externalPtr[input.first] = input.second->buffer();
+        }
+    }
+    for (auto& output : _outputs) {
+        auto graphOutput = graphOutputs.find(output.first);
+        if (graphOutput == graphOutputs.end())
+            continue;
+        const auto& graphDesc = graphOutput->second->getTensorDesc();
+        if (output.second->getTensorDesc().getDims() != graphDesc.getDims()) {
+            output.second = allocateBlob(InferenceEngine::TensorDesc(output.second->getTensorDesc().getPrecision(),
+                                                                     graphDesc.getDims(), graphDesc.getBlockingDesc()));
+        }
+        if (output.second->getTensorDesc() == graphDesc) {
+            externalPtr[output.first] = output.second->buffer();
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!reshapable) {
+        IInferRequestInternal::checkBlobs();
+        return;
+    }
+    // any shapes the network can be reshaped to are accepted, so only the allocation is checked
+    for (const auto& input : _inputs) {
+        checkBlob(input.second, input.first, true, input.second->getTensorDesc().getDims());
+    }
+    for (const auto& output : _outputs) {
+        checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
     if (!graph->getProperty().enableDynamicBatch)
         IE_THROW() << "Dynamic batch is not enabled.";
@@ -521,3 +624,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::ThrowIfCanceled() const {
         _asyncRequest->ThrowIfCanceled();
     }
 }
+
+void MKLDNNPlugin::MKLDNNInferRequest::ThrowIfCancelRequested() const {
+    if (_asyncRequest != nullptr) {
+        _asyncRequest->ThrowIfCancelRequested();
+    }
+}
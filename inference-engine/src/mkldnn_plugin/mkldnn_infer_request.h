@@ -8,12 +8,15 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
 
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
+class MKLDNNMemoryInputNode;
+class MKLDNNVariableState;
 
 class MKLDNNInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
@@ -34,6 +37,8 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void checkBlobs() override;
+
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
 
     /**
@@ -47,19 +52,48 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief The same as ThrowIfCanceled(), but takes no lock until the request is canceled. Is used by the graph
+     * execution loops
+     */
+    void ThrowIfCancelRequested() const;
+
 private:
+    /**
+     * @brief MemoryInput node of the graph paired with the request variable state
+     */
+    struct StateBinding {
+        MKLDNNMemoryInputNode* node;
+        MKLDNNVariableState* state;
+        bool updated;  // the state has MemoryOutput writer, so the buffers are swapped after inference
+    };
+    using StateBindings = std::vector<StateBinding>;
+
     void PushInputData();
+    const StateBindings& GetStateBindings();
     void PushStates();
     void PullStates();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+    InferenceEngine::Blob::Ptr allocateBlob(const InferenceEngine::TensorDesc& desc);
+    InferenceEngine::ICNNNetwork::InputShapes getInputShapes() const;
+    void redirectBlobs();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // the graph of the shape cache may be evicted while it is used by the request
+    std::shared_ptr<MKLDNNGraph>        graphHolder;
+    // the blobs may have the shapes other than the network ones, see CPU_SHAPE_CACHE_SIZE
+    bool                                reshapable = false;
+    // allocator of the request blobs, nullptr for the heap, see CPU_MEMORY_POOL
+    std::shared_ptr<InferenceEngine::IAllocator> memoryPool;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    // request may be executed on graphs of different streams, so the bindings are kept per graph
+    std::map<const MKLDNNGraph*, StateBindings> stateBindings;
+    const StateBindings*                stateBindingsCurrent = nullptr;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
 };
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_kernel_cache.hpp"
+
+#include <common/primitive_attr.hpp>
+
+using namespace MKLDNNPlugin;
+
+MKLDNNKernelKey::MKLDNNKernelKey(const std::string& kernelName) : _key(kernelName + ';') {}
+
+bool MKLDNNKernelKey::appendPostOps(const mkldnn_primitive_attr& attr) {
+    const auto& postOps = attr.post_ops_;
+    *this << postOps.len();
+    for (int i = 0; i < postOps.len(); i++) {
+        const auto& postOp = postOps.entry_[i];
+        if (postOp.is_eltwise()) {
+            *this << "eltwise" << postOp.eltwise.alg << postOp.eltwise.alpha << postOp.eltwise.beta << postOp.eltwise.scale;
+        } else if (postOp.is_depthwise()) {
+            *this << "depthwise" << postOp.depthwise.alg << static_cast<const void*>(postOp.depthwise.weights_data)
+                  << static_cast<const void*>(postOp.depthwise.biases_data);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+MKLDNNKernelCache::MKLDNNKernelCache(size_t capacity) : _capacity(capacity) {}
+
+std::shared_ptr<void> MKLDNNKernelCache::find(const std::string& key) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto found = _index.find(key);
+    if (found == _index.end()) {
+        _statistics.misses++;
+        return nullptr;
+    }
+    _statistics.hits++;
+    _kernels.splice(_kernels.begin(), _kernels, found->second);
+    return found->second->second;
+}
+
+std::shared_ptr<void> MKLDNNKernelCache::insert(const std::string& key, std::shared_ptr<void> kernel) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto found = _index.find(key);
+    if (found != _index.end()) {
+        _kernels.splice(_kernels.begin(), _kernels, found->second);
+        return found->second->second;
+    }
+    if (_capacity == 0)
+        return kernel;
+
+    _kernels.emplace_front(key, kernel);
+    _index[key] = _kernels.begin();
+    evict();
+    return kernel;
+}
+
+void MKLDNNKernelCache::evict() {
+    while (_kernels.size() > _capacity) {
+        _index.erase(_kernels.back().first);
+        _kernels.pop_back();
+        _statistics.evictions++;
+    }
+}
+
+void MKLDNNKernelCache::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _capacity = capacity;
+    evict();
+}
+
+void MKLDNNKernelCache::clear() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _index.clear();
+    _kernels.clear();
+}
+
+MKLDNNKernelCache::Statistics MKLDNNKernelCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto statistics = _statistics;
+    statistics.size = _kernels.size();
+    return statistics;
+}
+
+MKLDNNKernelCache::Ptr MKLDNNKernelCache::get() {
+    static auto cache = std::make_shared<MKLDNNKernelCache>();
+    return cache;
+}
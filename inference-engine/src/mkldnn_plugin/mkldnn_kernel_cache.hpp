@@ -0,0 +1,126 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn_types.h>
+
+#include <cstddef>
+#include <iomanip>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Key of the generated JIT kernel: the kernel name, the ISA and every parameter the code generation depends on
+ */
+class MKLDNNKernelKey {
+public:
+    explicit MKLDNNKernelKey(const std::string& kernelName);
+
+    template <typename T>
+    MKLDNNKernelKey& operator<<(const T& value) {
+        std::ostringstream stream;
+        // the scalars of the post ops differing in the last digits give different code
+        stream << std::setprecision(std::numeric_limits<double>::max_digits10) << value << ';';
+        _key += stream.str();
+        return *this;
+    }
+
+    /**
+     * Appends the post ops of the kernel attributes. The eltwise and the depthwise post ops are supported only,
+     * the addresses of the depthwise weights are the part of the key as the kernels embed them into the code
+     * @return false if the kernel generated for the post ops can't be shared
+     */
+    bool appendPostOps(const mkldnn_primitive_attr& attr);
+
+    const std::string& str() const {
+        return _key;
+    }
+
+private:
+    std::string _key;
+};
+
+/**
+ * Process wide cache of the JIT kernels of the nodes, so the nodes of the same parameters share the generated code
+ * instead of generating it for every node, every stream and every network. The least recently used kernels over
+ * the capacity are dropped by the cache, the nodes keep using the kernels they got.
+ *
+ * Is a thread safe
+ */
+class MKLDNNKernelCache {
+public:
+    typedef std::shared_ptr<MKLDNNKernelCache> Ptr;
+
+    struct Statistics {
+        size_t hits = 0;        // number of the kernels taken from the cache
+        size_t misses = 0;      // number of the kernels generated
+        size_t evictions = 0;   // number of the kernels dropped over the capacity
+        size_t size = 0;        // number of the kernels in the cache
+    };
+
+    static constexpr size_t kDefaultCapacity = 1024;
+
+    /**
+     * @param capacity
+     * number of the kernels kept, 0 disables the cache
+     */
+    explicit MKLDNNKernelCache(size_t capacity = kDefaultCapacity);
+
+    /**
+     * Returns the kernel of the key, the kernel is created by the creator (and cached) if the cache has no such one.
+     * The kernel is created without the lock, so the threads meeting the same new key may both generate it,
+     * the first one inserted is kept.
+     */
+    template <typename T, typename Creator>
+    std::shared_ptr<T> getOrCreate(const MKLDNNKernelKey& key, Creator create) {
+        const std::string fullKey = std::string(typeid(T).name()) + '|' + key.str();
+        if (auto kernel = find(fullKey))
+            return std::static_pointer_cast<T>(kernel);
+
+        std::shared_ptr<T> kernel = create();
+        if (!kernel)
+            return kernel;
+        return std::static_pointer_cast<T>(insert(fullKey, kernel));
+    }
+
+    void setCapacity(size_t capacity);
+
+    /**
+     * Drops all the kernels
+     */
+    void clear();
+
+    Statistics getStatistics() const;
+
+    /**
+     * Process wide cache
+     */
+    static Ptr get();
+
+private:
+    typedef std::list<std::pair<std::string, std::shared_ptr<void>>> Kernels;
+
+    std::shared_ptr<void> find(const std::string& key);
+    std::shared_ptr<void> insert(const std::string& key, std::shared_ptr<void> kernel);
+    void evict();
+
+    size_t _capacity;
+    mutable std::mutex _mutex;
+    // most recently used first
+    Kernels _kernels;
+    std::unordered_map<std::string, Kernels::iterator> _index;
+    Statistics _statistics;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,243 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_pool.hpp"
+
+#include <cstdlib>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+constexpr size_t kPageSize = 4096;
+
+void* heapAlloc(size_t size) {
+#ifdef _WIN32
+    return _aligned_malloc(size, MKLDNNMemoryPool::kAlignment);
+#else
+    void* ptr = nullptr;
+    return posix_memalign(&ptr, MKLDNNMemoryPool::kAlignment, size) == 0 ? ptr : nullptr;
+#endif
+}
+
+void heapFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+#if defined(__linux__)
+// the mapping is aligned to the huge page, so it may be backed by the transparent huge pages
+void* mapAligned(size_t size) {
+    const size_t mappedSize = size + MKLDNNMemoryPool::kHugePageSize;
+    void* mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED)
+        return nullptr;
+
+    const auto begin = reinterpret_cast<uintptr_t>(mapped);
+    const auto aligned = (begin + MKLDNNMemoryPool::kHugePageSize - 1) & ~(MKLDNNMemoryPool::kHugePageSize - 1);
+    if (aligned != begin)
+        munmap(mapped, aligned - begin);
+    const size_t tail = begin + mappedSize - (aligned + size);
+    if (tail != 0)
+        munmap(reinterpret_cast<void*>(aligned + size), tail);
+    return reinterpret_cast<void*>(aligned);
+}
+
+// the pages are placed on the NUMA node of the thread which touches them first
+void touchPages(void* ptr, size_t size) {
+    auto bytes = static_cast<volatile char*>(ptr);
+    for (size_t offset = 0; offset < size; offset += kPageSize)
+        bytes[offset] = 0;
+}
+#endif
+
+}  // namespace
+
+constexpr size_t MKLDNNMemoryPool::kHugePageSize;
+constexpr size_t MKLDNNMemoryPool::kAlignment;
+
+MKLDNNMemoryPool::MKLDNNMemoryPool(HugePages hugePages, size_t maxCachedBytes)
+    : _hugePages(hugePages), _maxCachedBytes(maxCachedBytes) {}
+
+MKLDNNMemoryPool::~MKLDNNMemoryPool() {
+    release();
+}
+
+size_t MKLDNNMemoryPool::sizeClass(size_t size) {
+    if (size <= kAlignment)
+        return kAlignment;
+    if (size >= kHugePageSize)
+        return (size + kHugePageSize - 1) & ~(kHugePageSize - 1);
+
+    // four classes per power of two, so at most 25% of the block is wasted
+    size_t power = kAlignment;
+    while (power * 2 < size)
+        power *= 2;
+    const size_t step = power / 4;
+    return (size + step - 1) / step * step;
+}
+
+void* MKLDNNMemoryPool::allocateBlock(size_t size, Backing& backing) {
+#if defined(__linux__)
+    if (size >= kHugePageSize && _hugePages != HugePages::None) {
+        void* ptr = nullptr;
+#ifdef MAP_HUGETLB
+        if (_hugePages == HugePages::Explicit) {
+            ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (ptr == MAP_FAILED) {
+                ptr = nullptr;
+            } else {
+                backing = Backing::HugePages;
+            }
+        }
+#endif
+        if (ptr == nullptr) {
+            ptr = mapAligned(size);
+            if (ptr == nullptr)
+                return nullptr;
+#ifdef MADV_HUGEPAGE
+            madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+            backing = Backing::Pages;
+        }
+        touchPages(ptr, size);
+        return ptr;
+    }
+#endif
+    backing = Backing::Heap;
+    return heapAlloc(size);
+}
+
+void MKLDNNMemoryPool::freeBlock(void* ptr, const Block& block) {
+#if defined(__linux__)
+    if (block.backing != Backing::Heap) {
+        munmap(ptr, block.size);
+        return;
+    }
+#endif
+    heapFree(ptr);
+}
+
+void* MKLDNNMemoryPool::alloc(size_t size) noexcept {
+    try {
+        const size_t blockSize = sizeClass(size);
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _statistics.allocations++;
+            auto cached = _cached.find(blockSize);
+            if (cached != _cached.end() && !cached->second.empty()) {
+                auto block = cached->second.back();
+                cached->second.pop_back();
+                _used.emplace(block.first, block.second);
+                _statistics.reused++;
+                _statistics.cachedBytes -= blockSize;
+                _statistics.usedBytes += blockSize;
+                return block.first;
+            }
+        }
+
+        // the OS allocation and the first touch are done without the lock
+        Block block{blockSize, Backing::Heap};
+        void* ptr = allocateBlock(blockSize, block.backing);
+        if (ptr == nullptr)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock{_mutex};
+        _used.emplace(ptr, block);
+        _statistics.usedBytes += blockSize;
+        if (block.backing != Backing::Heap)
+            _statistics.hugePageBytes += blockSize;
+        return ptr;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool MKLDNNMemoryPool::free(void* handle) noexcept {
+    try {
+        std::unique_lock<std::mutex> lock{_mutex};
+        auto used = _used.find(handle);
+        if (used == _used.end())
+            return false;
+        const Block block = used->second;
+        _used.erase(used);
+        _statistics.usedBytes -= block.size;
+
+        if (_statistics.cachedBytes + block.size <= _maxCachedBytes) {
+            _cached[block.size].emplace_back(handle, block);
+            _statistics.cachedBytes += block.size;
+            return true;
+        }
+        if (block.backing != Backing::Heap)
+            _statistics.hugePageBytes -= block.size;
+        lock.unlock();
+        freeBlock(handle, block);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+void MKLDNNMemoryPool::release() {
+    std::map<size_t, std::vector<std::pair<void*, Block>>> cached;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        cached.swap(_cached);
+        for (const auto& blocks : cached) {
+            for (const auto& block : blocks.second) {
+                if (block.second.backing != Backing::Heap)
+                    _statistics.hugePageBytes -= block.second.size;
+            }
+        }
+        _statistics.cachedBytes = 0;
+    }
+    for (const auto& blocks : cached) {
+        for (const auto& block : blocks.second)
+            freeBlock(block.first, block.second);
+    }
+}
+
+MKLDNNMemoryPool::Statistics MKLDNNMemoryPool::getStatistics() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _statistics;
+}
+
+namespace {
+
+std::mutex& poolsMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<std::pair<int, MKLDNNMemoryPool::HugePages>, MKLDNNMemoryPool::Ptr>& pools() {
+    static std::map<std::pair<int, MKLDNNMemoryPool::HugePages>, MKLDNNMemoryPool::Ptr> pools;
+    return pools;
+}
+
+}  // namespace
+
+MKLDNNMemoryPool::Ptr MKLDNNMemoryPool::get(int numaNodeId, HugePages hugePages) {
+    std::lock_guard<std::mutex> lock{poolsMutex()};
+    auto& pool = pools()[{numaNodeId < 0 ? -1 : numaNodeId, hugePages}];
+    if (!pool)
+        pool = std::make_shared<MKLDNNMemoryPool>(hugePages);
+    return pool;
+}
+
+void MKLDNNMemoryPool::releaseAll() {
+    std::lock_guard<std::mutex> lock{poolsMutex()};
+    for (auto& pool : pools())
+        pool.second->release();
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Allocator keeping the freed blocks for the following allocations of the same size class,
+ * so the graph workspaces and the blobs of the infer requests don't go to the OS every time.
+ * The large blocks are backed by huge pages and are touched by the allocating thread,
+ * so the pages are placed on the NUMA node of the stream which builds the graph.
+ *
+ * Is a thread safe
+ */
+class MKLDNNMemoryPool : public InferenceEngine::IAllocator {
+public:
+    typedef std::shared_ptr<MKLDNNMemoryPool> Ptr;
+
+    enum class HugePages {
+        // 4K pages only
+        None,
+        // the large blocks are aligned to the huge page and advised to be backed by the transparent huge pages
+        Transparent,
+        // the large blocks are allocated from the reserved huge pages, Transparent is used if there are no free ones
+        Explicit,
+    };
+
+    struct Statistics {
+        size_t allocations = 0;     // number of the alloc() calls
+        size_t reused = 0;          // number of the allocations served by the freed blocks
+        size_t usedBytes = 0;       // size of the blocks in use
+        size_t cachedBytes = 0;     // size of the freed blocks kept for reuse
+        size_t hugePageBytes = 0;   // size of the blocks backed by the huge pages, in use or cached
+    };
+
+    static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+    static constexpr size_t kAlignment = 64;
+
+    /**
+     * @param hugePages
+     * huge pages usage for the blocks of kHugePageSize and larger
+     * @param maxCachedBytes
+     * the freed blocks over this size are returned to the OS
+     */
+    explicit MKLDNNMemoryPool(HugePages hugePages, size_t maxCachedBytes = size_t(1) << 30);
+    ~MKLDNNMemoryPool();
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    /**
+     * Returns the cached blocks to the OS
+     */
+    void release();
+
+    Statistics getStatistics() const;
+
+    /**
+     * Size of the block actually allocated for the requested size
+     */
+    static size_t sizeClass(size_t size);
+
+    /**
+     * Process wide pool of the NUMA node, negative id gives the pool of the memory without NUMA preference
+     */
+    static Ptr get(int numaNodeId, HugePages hugePages);
+
+    /**
+     * Returns the cached blocks of all the process wide pools to the OS
+     */
+    static void releaseAll();
+
+private:
+    enum class Backing {
+        Heap,
+        Pages,
+        HugePages,
+    };
+
+    struct Block {
+        size_t size;
+        Backing backing;
+    };
+
+    void* allocateBlock(size_t size, Backing& backing);
+    void freeBlock(void* ptr, const Block& block);
+
+    const HugePages _hugePages;
+    const size_t _maxCachedBytes;
+    mutable std::mutex _mutex;
+    std::unordered_map<void*, Block> _used;
+    std::map<size_t, std::vector<std::pair<void*, Block>>> _cached;
+    Statistics _statistics;
+};
+
+}  // namespace MKLDNNPlugin
@@ -11,7 +11,22 @@ using namespace InferenceEngine;
 namespace MKLDNNPlugin {
 
 void  MKLDNNVariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    std::memset(currentState->buffer(), 0, currentState->byteSize());
+}
+
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    if (newState->byteSize() != state->byteSize()) {
+        IE_THROW() << "Variable state " << name << " has size " << state->byteSize()
+                   << " bytes, but new state has " << newState->byteSize() << " bytes";
+    }
+    // the state buffers are bound to the graph, so the data is copied instead of the blob replacement
+    cpu_memcpy(currentState->buffer(), newState->cbuffer(), state->byteSize());
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    // the buffers are swapped by every inference, so the current one is copied into the stable blob
+    cpu_memcpy(state->buffer(), currentState->cbuffer(), state->byteSize());
+    return state;
 }
 
 }  // namespace MKLDNNPlugin
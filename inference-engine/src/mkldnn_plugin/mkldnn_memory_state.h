@@ -13,16 +13,45 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * Variable state with two buffers. During inference MemoryInput node reads the current state
+ * directly from the front buffer and MemoryOutput node writes the next one into the back buffer,
+ * then the buffers are swapped, so the state is never copied between the request and the graph.
+ * The blob returned by GetState() is not bound to the graph: it stays valid, and the current state
+ * is copied into it on every GetState() call
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
     MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
             InferenceEngine::IVariableStateInternal{name} {
         state = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
         state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+
+        currentState = make_blob_with_precision(state->getTensorDesc());
+        currentState->allocate();
+        cpu_memcpy(currentState->buffer(), storage->GetData(), storage->GetSize());
+
+        nextState = make_blob_with_precision(state->getTensorDesc());
+        nextState->allocate();
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    void* GetCurrentData() {
+        return currentState->buffer();
+    }
+    void* GetNextData() {
+        return nextState->buffer();
+    }
+    void SwapBuffers() {
+        std::swap(currentState, nextState);
+    }
+
+private:
+    InferenceEngine::Blob::Ptr currentState;
+    InferenceEngine::Blob::Ptr nextState;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
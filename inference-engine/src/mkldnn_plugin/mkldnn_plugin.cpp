@@ -6,10 +6,16 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_memory_pool.hpp"
+#include "mkldnn_kernel_cache.hpp"
 #include "mkldnn_itt.h"
+#include "serialize.h"
 
 #include <threading/ie_executor_manager.hpp>
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
@@ -69,6 +75,7 @@
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/graph_util.hpp>
+#include <ngraph/runtime/parallel.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
@@ -88,6 +95,7 @@
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/insert_preprocessing.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -101,18 +109,67 @@
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+// The reference kernels of the constant folding and of the fallback nodes run on the threads of the caller,
+// i.e. on the threads of the stream for the fallback nodes, instead of running sequentially.
+// The executor is process wide, so it is installed by the first Engine and the previous one is restored by the last one
+static std::mutex parallelExecutorMutex;
+static size_t parallelExecutorUsers = 0;
+static ngraph::runtime::parallel_executor_t previousParallelExecutor;
+
+static void InstallParallelExecutor() {
+    std::lock_guard<std::mutex> lock{parallelExecutorMutex};
+    if (parallelExecutorUsers++ > 0)
+        return;
+    previousParallelExecutor = ngraph::runtime::set_parallel_executor(
+        [](size_t maxThreads, const std::function<void(size_t, size_t)>& body) {
+            const int threads = std::min(static_cast<int>(maxThreads), parallel_get_max_threads());
+            parallel_nt(threads, [&](const int ithr, const int nthr) {
+                body(ithr, nthr);
+            });
+        });
+}
+
+static void RestoreParallelExecutor() {
+    std::lock_guard<std::mutex> lock{parallelExecutorMutex};
+    if (--parallelExecutorUsers > 0)
+        return;
+    ngraph::runtime::set_parallel_executor(previousParallelExecutor);
+    previousParallelExecutor = nullptr;
+}
+
 Engine::Engine() {
     _pluginName = "CPU";
     extensionManager->AddExtension(std::make_shared<Extensions::Cpu::MKLDNNExtensions>());
+    InstallParallelExecutor();
 }
 
 Engine::~Engine() {
+    RestoreParallelExecutor();
     ExecutorManager::getInstance()->clear("CPU");
     ExecutorManager::getInstance()->clear("CPUStreamsExecutor");
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
+    MKLDNNMemoryPool::releaseAll();
+    MKLDNNKernelCache::get()->clear();
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
+// The mean and the scale become the operations of the network, so they are fused with the following nodes
+// and the graph reads the input blobs directly, instead of copying and normalizing them before the inference.
+// QueryNetwork() doesn't insert them, the inserted operations are not the layers of the queried network
+static void InsertPreprocessing(CNNNetwork& clonedNetwork) {
+    auto inputsInfo = clonedNetwork.getInputsInfo();
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<MKLDNNPlugin::InsertPreprocessing>(inputsInfo);
+    manager.run_passes(clonedNetwork.getFunction());
+
+    for (auto& input : inputsInfo) {
+        auto& preProcess = input.second->getPreProcess();
+        preProcess.init(0);
+        preProcess.setVariant(NONE);
+    }
+}
+
+static void TransformationUpToCPUSpecificOpSet(CNNNetwork& clonedNetwork, const Config& conf) {
     auto nGraphFunc = clonedNetwork.getFunction();
 
     ngraph::pass::Manager manager;
@@ -365,10 +422,31 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     });
 
     postLPTPassManager.run_passes(nGraphFunc);
+}
+
+static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
+    TransformationUpToCPUSpecificOpSet(clonedNetwork, conf);
 
+    auto nGraphFunc = clonedNetwork.getFunction();
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
+// The networks of the shape cache are made by reshaping a copy of the original network, since the transformed one
+// may have the shape sub-graphs folded to constants
+static MKLDNNExecNetwork::ReshapedNetworkFactory MakeReshapedNetworkFactory(const CNNNetwork& network, const Config& conf) {
+    if (conf.shapeCacheSize == 0)
+        return nullptr;
+
+    const CNNNetwork original = InferenceEngine::details::cloneNetwork(network);
+    return [original, conf](const ICNNNetwork::InputShapes& shapes) {
+        CNNNetwork reshaped = InferenceEngine::details::cloneNetwork(original);
+        reshaped.reshape(shapes);
+        InsertPreprocessing(reshaped);
+        Transformation(reshaped, conf);
+        return reshaped;
+    };
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -397,6 +475,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
     Config conf = engConfig;
     conf.readProperties(config);
+    MKLDNNKernelCache::get()->setCapacity(conf.kernelCacheCapacity);
 
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
@@ -404,14 +483,74 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
 
-    Transformation(clonedNetwork, conf);
+    InsertPreprocessing(clonedNetwork);
+    TransformationUpToCPUSpecificOpSet(clonedNetwork, conf);
+
+    // The network for the IR cache written by Export. With the model cache enabled the core exports the network right
+    // after the load, so a copy of the transformed network is kept if it can be stored as IR. Otherwise Export is
+    // rare, so the original network is written without copying and it's transformed again on import.
+    // NOTE: cloned Constants share data with the originals, so the copy doesn't duplicate weights
+    bool isTransformed = false;
+    CNNNetwork serializableNetwork = network;
+    if (!conf.cacheDir.empty()) {
+        isTransformed = isSerializableFunction(clonedNetwork.getFunction());
+        serializableNetwork = InferenceEngine::details::cloneNetwork(isTransformed ? clonedNetwork : network);
+    }
+
+    auto nGraphFunc = clonedNetwork.getFunction();
+    ConvertToCPUSpecificOpset(nGraphFunc);
+
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing,
+                                               serializableNetwork, isTransformed, MakeReshapedNetworkFactory(network, conf));
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr
+Engine::ImportNetwork(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "ImportNetwork");
+
+    // The exported network is an IR cache: it skips the common transformations,
+    // but the graph is compiled (primitives are created and weights are reordered) again
+    CNNNetworkDeserializer deserializer(networkModel,
+        [this](const std::string& model, const Blob::CPtr& weights) {
+            return GetCore()->ReadNetwork(model, weights);
+        });
+
+    CNNNetwork cnnnetwork;
+    deserializer >> cnnnetwork;
+
+    Config conf = engConfig;
+    conf.readProperties(config);
+    MKLDNNKernelCache::get()->setCapacity(conf.kernelCacheCapacity);
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
+    }
+
+    CNNNetwork serializableNetwork = InferenceEngine::details::cloneNetwork(cnnnetwork);
+    if (deserializer.isTransformed()) {
+        auto nGraphFunc = cnnnetwork.getFunction();
+        ConvertToCPUSpecificOpset(nGraphFunc);
+    } else {
+        InsertPreprocessing(cnnnetwork);
+        Transformation(cnnnetwork, conf);
+    }
+
+    // the transformed IR can't be reshaped, so the shape cache is available for the original one only
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing,
+                                                           serializableNetwork, deserializer.isTransformed(),
+                                                           deserializer.isTransformed() ? nullptr : MakeReshapedNetworkFactory(serializableNetwork, conf));
+
+    execNetwork->setNetworkInputs(copyInfo(serializableNetwork.getInputsInfo()));
+    execNetwork->setNetworkOutputs(copyInfo(serializableNetwork.getOutputsInfo()));
+    execNetwork->SetPointerToPlugin(shared_from_this());
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    MKLDNNKernelCache::get()->setCapacity(engConfig.kernelCacheCapacity);
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -449,6 +588,10 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+        metrics.push_back(METRIC_KEY(CPU_KERNEL_CACHE_HITS));
+        metrics.push_back(METRIC_KEY(CPU_KERNEL_CACHE_MISSES));
+        metrics.push_back(METRIC_KEY(CPU_KERNEL_CACHE_SIZE));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -495,6 +638,14 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == METRIC_KEY(CPU_KERNEL_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(CPU_KERNEL_CACHE_HITS, static_cast<uint64_t>(MKLDNNKernelCache::get()->getStatistics().hits));
+    } else if (name == METRIC_KEY(CPU_KERNEL_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(CPU_KERNEL_CACHE_MISSES, static_cast<uint64_t>(MKLDNNKernelCache::get()->getStatistics().misses));
+    } else if (name == METRIC_KEY(CPU_KERNEL_CACHE_SIZE)) {
+        IE_SET_METRIC_RETURN(CPU_KERNEL_CACHE_SIZE, static_cast<uint64_t>(MKLDNNKernelCache::get()->getStatistics().size));
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
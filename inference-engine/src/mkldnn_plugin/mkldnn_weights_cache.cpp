@@ -5,10 +5,122 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+namespace {
+
+constexpr uint64_t kPrime1 = 11400714785074694791ULL;
+constexpr uint64_t kPrime2 = 14029467366897019727ULL;
+constexpr uint64_t kPrime3 = 1609587929392839161ULL;
+constexpr uint64_t kPrime4 = 9650029242287828579ULL;
+constexpr uint64_t kPrime5 = 2870177450012600261ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t xxRound(uint64_t acc, uint64_t input) {
+    acc += input * kPrime2;
+    acc = rotl(acc, 31);
+    return acc * kPrime1;
+}
+
+inline uint64_t xxMergeRound(uint64_t acc, uint64_t val) {
+    acc ^= xxRound(0, val);
+    return acc * kPrime1 + kPrime4;
+}
+
+// xxHash64 by Yann Collet, processes 32 bytes per iteration in four independent lanes
+uint64_t xxhash64(const unsigned char* data, size_t size, uint64_t seed) {
+    const unsigned char* p = data;
+    const unsigned char* const end = data + size;
+    uint64_t h64;
+
+    if (size >= 32) {
+        const unsigned char* const limit = end - 32;
+        uint64_t v1 = seed + kPrime1 + kPrime2;
+        uint64_t v2 = seed + kPrime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - kPrime1;
+
+        do {
+            v1 = xxRound(v1, read64(p));
+            v2 = xxRound(v2, read64(p + 8));
+            v3 = xxRound(v3, read64(p + 16));
+            v4 = xxRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h64 = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h64 = xxMergeRound(h64, v1);
+        h64 = xxMergeRound(h64, v2);
+        h64 = xxMergeRound(h64, v3);
+        h64 = xxMergeRound(h64, v4);
+    } else {
+        h64 = seed + kPrime5;
+    }
+
+    h64 += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h64 ^= xxRound(0, read64(p));
+        h64 = rotl(h64, 27) * kPrime1 + kPrime4;
+    }
+    if (p + 4 <= end) {
+        h64 ^= static_cast<uint64_t>(read32(p)) * kPrime1;
+        h64 = rotl(h64, 23) * kPrime2 + kPrime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h64 ^= static_cast<uint64_t>(*p) * kPrime5;
+        h64 = rotl(h64, 11) * kPrime1;
+    }
+
+    h64 ^= h64 >> 33;
+    h64 *= kPrime2;
+    h64 ^= h64 >> 29;
+    h64 *= kPrime3;
+    h64 ^= h64 >> 32;
+    return h64;
+}
+
+}  // namespace
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kChunkSize)
+        return xxhash64(data, size, 0);
+
+    const size_t chunks = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> chunkHashes(chunks);
+    InferenceEngine::parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        chunkHashes[i] = xxhash64(data + offset, std::min(kChunkSize, size - offset), i);
+    });
+
+    return xxhash64(reinterpret_cast<const unsigned char*>(chunkHashes.data()),
+                    chunkHashes.size() * sizeof(uint64_t), size);
+}
+
+constexpr size_t SimpleDataHash::kChunkSize;
+
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
@@ -47,6 +159,7 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
         newPtr = create();
         ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
         sharedWeights[key] = ptr;
+        removeExpired();
     }
 
     return std::make_shared<MKLDNNSharedMemory>(ptr->valid.load(std::memory_order_relaxed)
@@ -70,6 +183,20 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+void MKLDNNWeightsSharing::removeExpired() {
+    // the keys of the released graphs, e.g. of the evicted shapes of the shape cache, are removed as the map doubles,
+    // so the cost is amortized over the insertions
+    if (sharedWeights.size() < 2 * sizeAfterRemoval)
+        return;
+    for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+        if (it->second->sharedMemory.expired())
+            it = sharedWeights.erase(it);
+        else
+            ++it;
+    }
+    sizeAfterRemoval = sharedWeights.size();
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
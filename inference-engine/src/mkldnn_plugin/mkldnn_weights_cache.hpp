@@ -22,28 +22,16 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * Hash of constant data used as a part of the weights sharing key.
+ * Data is split into fixed size chunks which are hashed in parallel by xxHash64,
+ * so the result does not depend on the number of threads
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static constexpr size_t kChunkSize = 1 << 20;
 };
 
 /**
@@ -96,8 +84,12 @@ public:
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    // removes the entries of the released memory, the guard is held by the caller
+    void removeExpired();
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
+    size_t sizeAfterRemoval = 0;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "insert_preprocessing.hpp"
+
+#include <cstring>
+#include <ie_common.h>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::InsertPreprocessing, "InsertPreprocessing", 0);
+
+using namespace InferenceEngine;
+
+namespace {
+
+// the constant of the per channel values is broadcast to the input as [1, C, 1, ...]
+std::shared_ptr<ngraph::Node> makeChannelsConstant(const ngraph::element::Type& type, size_t rank, const std::vector<float>& values) {
+    ngraph::Shape shape(rank, 1);
+    shape[1] = values.size();
+    return ngraph::opset1::Constant::create(type, shape, values);
+}
+
+// the mean image is subtracted from the [N, C, H, W] input, its height and width must be equal to the input ones:
+// the constant is broadcast over the batch only
+std::shared_ptr<ngraph::Node> makeMeanImageConstant(const ngraph::element::Type& type,
+                                                    const ngraph::PartialShape& shape,
+                                                    const PreProcessInfo& pp) {
+    const size_t channels = pp.getNumberOfChannels();
+    for (size_t channel = 0; channel < channels; channel++) {
+        const Blob::Ptr& meanBlob = pp[channel]->meanData;
+        if (!meanBlob || meanBlob->getTensorDesc().getPrecision() != Precision::FP32)
+            IE_THROW() << "mean image not provided or not in Float 32";
+    }
+    if (shape.rank().get_length() != 4 || shape[2].is_dynamic() || shape[3].is_dynamic())
+        IE_THROW() << "mean image is supported for the 4D inputs with static height and width only, the input shape is "
+                   << shape;
+    const size_t height = shape[2].get_length();
+    const size_t width = shape[3].get_length();
+
+    std::vector<float> meanImage(channels * height * width);
+    for (size_t channel = 0; channel < channels; channel++) {
+        const Blob::Ptr& meanBlob = pp[channel]->meanData;
+        const auto& meanDims = meanBlob->getTensorDesc().getDims();
+        if (meanDims.size() != 2 || meanDims[0] != height || meanDims[1] != width) {
+            IE_THROW() << "mean image size does not match expected network input, expecting " << width << " x " << height;
+        }
+        auto lockedMemory = meanBlob->cbuffer();
+        std::memcpy(meanImage.data() + channel * height * width, lockedMemory.as<const float*>(), meanBlob->byteSize());
+    }
+    return ngraph::opset1::Constant::create(type, {channels, height, width}, meanImage);
+}
+
+}  // namespace
+
+MKLDNNPlugin::InsertPreprocessing::InsertPreprocessing(const InputsDataMap& inputsInfo) : inputsInfo(inputsInfo) {}
+
+bool MKLDNNPlugin::InsertPreprocessing::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    bool changed = false;
+    for (const auto& param : f->get_parameters()) {
+        const auto input = inputsInfo.find(param->get_friendly_name());
+        if (input == inputsInfo.end() || !input->second)
+            continue;
+
+        const PreProcessInfo& pp = input->second->getPreProcess();
+        const size_t channels = pp.getNumberOfChannels();
+        if (channels == 0 || pp.getMeanVariant() == NONE)
+            continue;
+
+        const auto& shape = param->get_partial_shape();
+        if (shape.rank().is_dynamic() || shape.rank().get_length() < 2 || shape[1].is_dynamic() ||
+            static_cast<size_t>(shape[1].get_length()) != channels) {
+            IE_THROW() << "channels mismatch between mean and input";
+        }
+        const auto& type = param->get_element_type();
+        if (!type.is_real()) {
+            IE_THROW() << "Mean image of type " << type << " is unsupported";
+        }
+
+        // the consumers are taken before the preprocessing becomes one of them
+        const auto consumers = param->output(0).get_target_inputs();
+        ngraph::Output<ngraph::Node> preprocessed = param;
+        ngraph::NodeVector preprocessing;
+        switch (pp.getMeanVariant()) {
+            case MEAN_VALUE: {
+                std::vector<float> meanValues(channels), stdScales(channels);
+                bool hasMean = false, hasScale = false;
+                for (size_t channel = 0; channel < channels; channel++) {
+                    if (pp[channel]->stdScale == 0) {
+                        IE_THROW() << "Preprocessing error: stdScale cannot be equal zero";
+                    }
+                    meanValues[channel] = pp[channel]->meanValue;
+                    stdScales[channel] = pp[channel]->stdScale;
+                    hasMean = hasMean || meanValues[channel] != 0.f;
+                    hasScale = hasScale || stdScales[channel] != 1.f;
+                }
+                if (hasMean) {
+                    preprocessed = std::make_shared<ngraph::opset1::Subtract>(preprocessed,
+                                                                              makeChannelsConstant(type, shape.rank().get_length(), meanValues));
+                    preprocessed.get_node()->set_friendly_name(param->get_friendly_name() + "/MeanValue");
+                    preprocessing.push_back(preprocessed.get_node_shared_ptr());
+                }
+                if (hasScale) {
+                    preprocessed = std::make_shared<ngraph::opset1::Divide>(preprocessed,
+                                                                            makeChannelsConstant(type, shape.rank().get_length(), stdScales));
+                    preprocessed.get_node()->set_friendly_name(param->get_friendly_name() + "/StdScale");
+                    preprocessing.push_back(preprocessed.get_node_shared_ptr());
+                }
+                break;
+            }
+            case MEAN_IMAGE: {
+                preprocessed = std::make_shared<ngraph::opset1::Subtract>(preprocessed, makeMeanImageConstant(type, shape, pp));
+                preprocessed.get_node()->set_friendly_name(param->get_friendly_name() + "/MeanImage");
+                preprocessing.push_back(preprocessed.get_node_shared_ptr());
+                break;
+            }
+            default:
+                IE_THROW() << "Unsupported mean variant: " << pp.getMeanVariant();
+        }
+
+        if (preprocessing.empty())
+            continue;
+        ngraph::copy_runtime_info(param, preprocessing);
+        for (auto consumer : consumers)
+            consumer.replace_source_output(preprocessed);
+        changed = true;
+    }
+    return changed;
+}
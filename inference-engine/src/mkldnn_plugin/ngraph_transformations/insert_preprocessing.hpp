@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+#include <ie_input_info.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Inserts the mean and the scale of PreProcessInfo as the operations following the Parameters:
+ *      (x - meanValue) / stdScale
+ *      x - meanImage
+ * so the preprocessing is executed by the graph nodes, which are fused with the following ones
+ * and read the input blobs directly, instead of the separate pass over the input data.
+ * The mean image must have the height and the width of the 4D input, it isn't broadcast.
+ * Only the mean and the scale are inserted. The resize and the NV12/I420 color conversion are still
+ * done by the G-API preprocessing of the infer request: the frame size is known only when the blob
+ * is set, and the opsets of the plugin have no color conversion operation. The input layout is
+ * converted by the reorder following the Input node.
+ * TODO: the resize, the NV12/I420 conversion and the fusion of the preprocessing with the input
+ * reorder of the first convolution are the open part of the in-graph preprocessing.
+ */
+class InsertPreprocessing: public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit InsertPreprocessing(const InferenceEngine::InputsDataMap& inputsInfo);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    const InferenceEngine::InputsDataMap inputsInfo;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,208 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "box_nms.hpp"
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+template <bool suppress_equal>
+inline bool exceeds(float iou, float threshold) {
+    return suppress_equal ? threshold <= iou : threshold < iou;
+}
+
+// IoU of the candidate box (c) and the selected one (k), the area of the candidate is positive
+inline float intersection_over_union(float cx0, float cy0, float cx1, float cy1, float carea,
+                                     float kx0, float ky0, float kx1, float ky1, float karea,
+                                     float coordinates_offset) {
+    if (!(cx0 <= kx1 && cy0 <= ky1 && kx0 <= cx1 && ky0 <= cy1 && karea > 0.f))
+        return 0.f;
+
+    const float width  = std::max(0.f, std::min(cx1, kx1) - std::max(cx0, kx0) + coordinates_offset);
+    const float height = std::max(0.f, std::min(cy1, ky1) - std::max(cy0, ky0) + coordinates_offset);
+    const float intersection = width * height;
+
+    return intersection / (carea + karea - intersection);
+}
+
+// selected boxes in the structure of arrays layout
+struct selected_boxes {
+    explicit selected_boxes(int capacity) : data(5 * static_cast<size_t>(capacity)) {
+        x0 = &data[0];
+        y0 = x0 + capacity;
+        x1 = y0 + capacity;
+        y1 = x1 + capacity;
+        area = y1 + capacity;
+    }
+
+    std::vector<float> data;
+    float *x0, *y0, *x1, *y1, *area;
+    int count = 0;
+};
+
+template <bool suppress_equal>
+bool is_suppressed(const selected_boxes& kept, float cx0, float cy0, float cx1, float cy1, float carea, const nms_conf& conf) {
+    int j = 0;
+
+#if defined(HAVE_AVX512F)
+    const __m512 vcx0 = _mm512_set1_ps(cx0);
+    const __m512 vcy0 = _mm512_set1_ps(cy0);
+    const __m512 vcx1 = _mm512_set1_ps(cx1);
+    const __m512 vcy1 = _mm512_set1_ps(cy1);
+    const __m512 vcarea = _mm512_set1_ps(carea);
+    const __m512 voffset = _mm512_set1_ps(conf.coordinates_offset);
+    const __m512 vthreshold = _mm512_set1_ps(conf.iou_threshold);
+    const __m512 vzero = _mm512_setzero_ps();
+
+    for (; j <= kept.count - 16; j += 16) {
+        const __m512 vkx0 = _mm512_loadu_ps(kept.x0 + j);
+        const __m512 vky0 = _mm512_loadu_ps(kept.y0 + j);
+        const __m512 vkx1 = _mm512_loadu_ps(kept.x1 + j);
+        const __m512 vky1 = _mm512_loadu_ps(kept.y1 + j);
+        const __m512 vkarea = _mm512_loadu_ps(kept.area + j);
+
+        const __mmask16 overlapped = _mm512_cmp_ps_mask(vcx0, vkx1, _CMP_LE_OS) & _mm512_cmp_ps_mask(vcy0, vky1, _CMP_LE_OS) &
+                                     _mm512_cmp_ps_mask(vkx0, vcx1, _CMP_LE_OS) & _mm512_cmp_ps_mask(vky0, vcy1, _CMP_LE_OS) &
+                                     _mm512_cmp_ps_mask(vzero, vkarea, _CMP_LT_OS);
+
+        const __m512 vwidth  = _mm512_max_ps(vzero, _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(vcx1, vkx1), _mm512_max_ps(vcx0, vkx0)), voffset));
+        const __m512 vheight = _mm512_max_ps(vzero, _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(vcy1, vky1), _mm512_max_ps(vcy0, vky0)), voffset));
+        const __m512 vintersection = _mm512_mul_ps(vwidth, vheight);
+        const __m512 viou = _mm512_maskz_div_ps(overlapped, vintersection,
+                                                _mm512_sub_ps(_mm512_add_ps(vcarea, vkarea), vintersection));
+
+        if (_mm512_cmp_ps_mask(vthreshold, viou, suppress_equal ? _CMP_LE_OS : _CMP_LT_OS))
+            return true;
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 vcx0 = _mm256_set1_ps(cx0);
+    const __m256 vcy0 = _mm256_set1_ps(cy0);
+    const __m256 vcx1 = _mm256_set1_ps(cx1);
+    const __m256 vcy1 = _mm256_set1_ps(cy1);
+    const __m256 vcarea = _mm256_set1_ps(carea);
+    const __m256 voffset = _mm256_set1_ps(conf.coordinates_offset);
+    const __m256 vthreshold = _mm256_set1_ps(conf.iou_threshold);
+    const __m256 vzero = _mm256_setzero_ps();
+
+    for (; j <= kept.count - 8; j += 8) {
+        const __m256 vkx0 = _mm256_loadu_ps(kept.x0 + j);
+        const __m256 vky0 = _mm256_loadu_ps(kept.y0 + j);
+        const __m256 vkx1 = _mm256_loadu_ps(kept.x1 + j);
+        const __m256 vky1 = _mm256_loadu_ps(kept.y1 + j);
+        const __m256 vkarea = _mm256_loadu_ps(kept.area + j);
+
+        __m256 voverlapped = _mm256_and_ps(_mm256_cmp_ps(vcx0, vkx1, _CMP_LE_OS), _mm256_cmp_ps(vcy0, vky1, _CMP_LE_OS));
+        voverlapped = _mm256_and_ps(voverlapped, _mm256_cmp_ps(vkx0, vcx1, _CMP_LE_OS));
+        voverlapped = _mm256_and_ps(voverlapped, _mm256_cmp_ps(vky0, vcy1, _CMP_LE_OS));
+        voverlapped = _mm256_and_ps(voverlapped, _mm256_cmp_ps(vzero, vkarea, _CMP_LT_OS));
+
+        const __m256 vwidth  = _mm256_max_ps(vzero, _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(vcx1, vkx1), _mm256_max_ps(vcx0, vkx0)), voffset));
+        const __m256 vheight = _mm256_max_ps(vzero, _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(vcy1, vky1), _mm256_max_ps(vcy0, vky0)), voffset));
+        const __m256 vintersection = _mm256_mul_ps(vwidth, vheight);
+        const __m256 viou = _mm256_and_ps(voverlapped,
+                                          _mm256_div_ps(vintersection, _mm256_sub_ps(_mm256_add_ps(vcarea, vkarea), vintersection)));
+
+        if (_mm256_movemask_ps(_mm256_cmp_ps(vthreshold, viou, suppress_equal ? _CMP_LE_OS : _CMP_LT_OS)))
+            return true;
+    }
+#elif defined(HAVE_SSE42)
+    const __m128 vcx0 = _mm_set1_ps(cx0);
+    const __m128 vcy0 = _mm_set1_ps(cy0);
+    const __m128 vcx1 = _mm_set1_ps(cx1);
+    const __m128 vcy1 = _mm_set1_ps(cy1);
+    const __m128 vcarea = _mm_set1_ps(carea);
+    const __m128 voffset = _mm_set1_ps(conf.coordinates_offset);
+    const __m128 vthreshold = _mm_set1_ps(conf.iou_threshold);
+    const __m128 vzero = _mm_setzero_ps();
+
+    for (; j <= kept.count - 4; j += 4) {
+        const __m128 vkx0 = _mm_loadu_ps(kept.x0 + j);
+        const __m128 vky0 = _mm_loadu_ps(kept.y0 + j);
+        const __m128 vkx1 = _mm_loadu_ps(kept.x1 + j);
+        const __m128 vky1 = _mm_loadu_ps(kept.y1 + j);
+        const __m128 vkarea = _mm_loadu_ps(kept.area + j);
+
+        __m128 voverlapped = _mm_and_ps(_mm_cmple_ps(vcx0, vkx1), _mm_cmple_ps(vcy0, vky1));
+        voverlapped = _mm_and_ps(voverlapped, _mm_cmple_ps(vkx0, vcx1));
+        voverlapped = _mm_and_ps(voverlapped, _mm_cmple_ps(vky0, vcy1));
+        voverlapped = _mm_and_ps(voverlapped, _mm_cmplt_ps(vzero, vkarea));
+
+        const __m128 vwidth  = _mm_max_ps(vzero, _mm_add_ps(_mm_sub_ps(_mm_min_ps(vcx1, vkx1), _mm_max_ps(vcx0, vkx0)), voffset));
+        const __m128 vheight = _mm_max_ps(vzero, _mm_add_ps(_mm_sub_ps(_mm_min_ps(vcy1, vky1), _mm_max_ps(vcy0, vky0)), voffset));
+        const __m128 vintersection = _mm_mul_ps(vwidth, vheight);
+        const __m128 viou = _mm_and_ps(voverlapped,
+                                       _mm_div_ps(vintersection, _mm_sub_ps(_mm_add_ps(vcarea, vkarea), vintersection)));
+
+        const __m128 vsuppressed = suppress_equal ? _mm_cmple_ps(vthreshold, viou) : _mm_cmplt_ps(vthreshold, viou);
+        if (_mm_movemask_ps(vsuppressed))
+            return true;
+    }
+#endif
+
+    for (; j < kept.count; j++) {
+        const float iou = intersection_over_union(cx0, cy0, cx1, cy1, carea,
+                                                  kept.x0[j], kept.y0[j], kept.x1[j], kept.y1[j], kept.area[j],
+                                                  conf.coordinates_offset);
+        if (exceeds<suppress_equal>(iou, conf.iou_threshold))
+            return true;
+    }
+    return false;
+}
+
+template <bool suppress_equal>
+int nms_boxes_impl(const float* x0, const float* y0, const float* x1, const float* y1, int stride,
+                   const int* order, int num_candidates, int max_selected, const nms_conf& conf, int* selected) {
+    const int capacity = max_selected < 0 ? num_candidates : std::min(num_candidates, max_selected);
+    if (capacity <= 0)
+        return 0;
+
+    selected_boxes kept(capacity);
+    for (int i = 0; i < num_candidates && kept.count < capacity; i++) {
+        const int idx = order ? order[i] : i;
+        const size_t offset = static_cast<size_t>(idx) * stride;
+        const float cx0 = x0[offset];
+        const float cy0 = y0[offset];
+        const float cx1 = x1[offset];
+        const float cy1 = y1[offset];
+        const float carea = (cx1 - cx0 + conf.coordinates_offset) * (cy1 - cy0 + conf.coordinates_offset);
+
+        // IoU with a box of non-positive area is 0, so it is suppressed only by a non-positive threshold
+        const bool suppressed = carea > 0.f ? is_suppressed<suppress_equal>(kept, cx0, cy0, cx1, cy1, carea, conf)
+                                            : kept.count > 0 && exceeds<suppress_equal>(0.f, conf.iou_threshold);
+        if (suppressed)
+            continue;
+
+        kept.x0[kept.count] = cx0;
+        kept.y0[kept.count] = cy0;
+        kept.x1[kept.count] = cx1;
+        kept.y1[kept.count] = cy1;
+        kept.area[kept.count] = carea;
+        selected[kept.count++] = idx;
+    }
+    return kept.count;
+}
+
+}  // namespace
+
+int nms_boxes(const float* x0, const float* y0, const float* x1, const float* y1, int stride,
+              const int* order, int num_candidates, int max_selected, const nms_conf& conf, int* selected) {
+    return conf.suppress_equal ? nms_boxes_impl<true>(x0, y0, x1, y1, stride, order, num_candidates, max_selected, conf, selected)
+                               : nms_boxes_impl<false>(x0, y0, x1, y1, stride, order, num_candidates, max_selected, conf, selected);
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
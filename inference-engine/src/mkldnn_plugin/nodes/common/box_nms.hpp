@@ -0,0 +1,49 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct nms_conf {
+    float iou_threshold;
+    // added to the box sizes: 1 for the boxes in pixel coordinates (Caffe style), 0 for the normalized ones
+    float coordinates_offset;
+    // suppress boxes with IoU equal to the threshold (iou >= threshold instead of iou > threshold)
+    bool suppress_equal;
+};
+
+namespace XARCH {
+
+/**
+ * @brief Greedy non-maximum suppression of the boxes sorted by the score in descending order.
+ * The candidate is selected if its IoU with every previously selected box does not exceed the threshold.
+ * IoU with a disjoint box or a box of non-positive area is 0. The candidate is compared with all the selected
+ * boxes at once: they are kept in a structure of arrays and processed with the widest available SIMD instructions.
+ * @param x0, y0, x1, y1
+ * coordinates of the box corners (x0 <= x1, y0 <= y1), coordinates of the box i are x0[i * stride], ...
+ * @param stride
+ * distance between the coordinates of the adjacent boxes: 4 for [x0, y0, x1, y1] boxes, 1 for separate arrays
+ * @param order
+ * indices of the candidate boxes sorted by the score, nullptr means the boxes are sorted already
+ * @param num_candidates
+ * number of the candidate boxes
+ * @param max_selected
+ * maximum number of the boxes to select, negative means no limit
+ * @param conf
+ * suppression parameters
+ * @param selected
+ * indices of the selected boxes in the selection order, should have room for min(num_candidates, max_selected)
+ * @return number of the selected boxes
+ */
+
+int nms_boxes(const float* x0, const float* y0, const float* x1, const float* y1, int stride,
+              const int* order, int num_candidates, int max_selected, const nms_conf& conf, int* selected);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -5,26 +5,379 @@
 #include "cpu_convert.h"
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include "emitters/jit_load_store_emitters.hpp"
+#include <cpu/x64/jit_generator.hpp>
 #include <mkldnn_selective_build.h>
+#include <ngraph/type/float16.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
 #include <type_traits>
 #include <tuple>
+#include <utility>
 #include <ie_parallel.hpp>
 
 using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
 
 namespace {
 
+#define GET_OFF(field) offsetof(jit_convert_call_args, field)
+
+struct jit_convert_call_args {
+    const void *src;
+    void *dst;
+    size_t work_amount;
+};
+
+struct jit_convert_kernel {
+    void (*ker_)(const jit_convert_call_args *);
+
+    void operator()(const jit_convert_call_args *args) const {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_convert_kernel(Precision src_prc, Precision dst_prc) : ker_(nullptr), src_prc_(src_prc), dst_prc_(dst_prc) {}
+    virtual ~jit_convert_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    Precision src_prc_;
+    Precision dst_prc_;
+};
+
+bool isFloatingPoint(Precision prc) {
+    return prc == Precision::FP32 || prc == Precision::BF16 || prc == Precision::FP16;
+}
+
+/**
+ * Values are loaded to vector registers as FP32 (for floating point sources) or I32 (for integer sources),
+ * converted between FP32 and I32 if necessary and stored with the destination precision. Float to integer conversion
+ * truncates towards zero, integer destinations are saturated, so the result is the same as the one of saturate_cast below.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_convert_kernel : public jit_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_convert_kernel)
+
+    jit_uni_convert_kernel(Precision src_prc, Precision dst_prc) : jit_convert_kernel(src_prc, dst_prc), jit_generator() {
+        load_prc = isFloatingPoint(src_prc_) ? Precision::FP32 : Precision::I32;
+        store_prc = isFloatingPoint(dst_prc_) ? Precision::FP32 : Precision::I32;
+    }
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+        if (load_prc == Precision::FP32 && store_prc == Precision::I32) {
+            broadcast(vmm_i32_min, float2int(-2147483648.f));
+            broadcast(vmm_i32_overflow, float2int(2147483648.f));
+            if (isa == cpu::x64::avx512_common)
+                broadcast(vmm_i32_max, std::numeric_limits<int32_t>::max());
+        }
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        convert_loop(unroll_factor * step, [&]() {
+            for (int i = 0; i < unroll_factor; i++)
+                convert_vector(Vmm(i), step, i * step);
+        });
+        convert_loop(step, [&]() {
+            convert_vector(Vmm(0), step, 0);
+        });
+        convert_loop(1, [&]() {
+            convert_vector(Vmm(0), 1, 0);
+        });
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    // register which holds a vector of FP16 values converted to/from Vmm of FP32 values
+    using Vmm_half = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Xmm, Xbyak::Ymm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+    static constexpr int unroll_factor = 4;
+
+    Precision load_prc;
+    Precision store_prc;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_tmp = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+
+    // Vmm(0) ... Vmm(unroll_factor - 1) are used for data
+    Vmm vmm_zero = Vmm(unroll_factor);
+    Vmm vmm_i32_min = Vmm(unroll_factor + 1);
+    Vmm vmm_i32_overflow = Vmm(unroll_factor + 2);
+    Vmm vmm_i32_max = Vmm(unroll_factor + 3);
+    Vmm vmm_aux = Vmm(unroll_factor + 4);
+    Xbyak::Xmm xmm_aux = Xbyak::Xmm(unroll_factor + 4);
+    Xbyak::Opmask k_overflow = Xbyak::Opmask(2);
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    void broadcast(const Vmm &vmm, int32_t value) {
+        mov(reg_tmp.cvt32(), value);
+        movd(xmm_aux, reg_tmp.cvt32());
+        uni_vbroadcastss(vmm, xmm_aux);
+    }
+
+    template <typename F>
+    void convert_loop(int elt_num, F body) {
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, elt_num);
+            jl(loop_end_label, T_NEAR);
+
+            body();
+
+            add(reg_src, elt_num * src_prc_.size());
+            add(reg_dst, elt_num * dst_prc_.size());
+            sub(reg_work_amount, elt_num);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+    }
+
+    void convert_vector(const Vmm &vmm, int elt_num, int elt_offset) {
+        const auto idx = static_cast<size_t>(vmm.getIdx());
+
+        if (src_prc_ == Precision::FP16) {
+            load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {idx},
+                std::make_shared<load_emitter_context>(Precision::FP16, Precision::FP16, elt_num, elt_offset * src_prc_.size()),
+                {}, {load_pool_gpr_idxs});
+            vcvtph2ps(vmm, Vmm_half(vmm.getIdx()));
+        } else {
+            load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {idx},
+                std::make_shared<load_emitter_context>(src_prc_, load_prc, elt_num, elt_offset * src_prc_.size()),
+                {}, {load_pool_gpr_idxs});
+        }
+
+        if (load_prc == Precision::FP32 && store_prc == Precision::I32) {
+            // NaN and values below the I32 range are replaced with the lower bound. Values above the range
+            // are converted to 0x80000000 by the instruction, so they are replaced with I32 max afterwards.
+            uni_vmaxps(vmm, vmm, vmm_i32_min);
+            if (isa == cpu::x64::avx512_common) {
+                vcmpps(k_overflow, vmm, vmm_i32_overflow, _cmp_nlt_us);
+                vcvttps2dq(vmm, vmm);
+                vmovdqa32(vmm | k_overflow, vmm_i32_max);
+            } else if (isa == cpu::x64::avx2) {
+                vcmpps(vmm_aux, vmm, vmm_i32_overflow, _cmp_nlt_us);
+                vcvttps2dq(vmm, vmm);
+                vpxor(vmm, vmm, vmm_aux);
+            } else {
+                movups(vmm_aux, vmm);
+                cmpps(vmm_aux, vmm_i32_overflow, _cmp_nlt_us);
+                cvttps2dq(vmm, vmm);
+                pxor(vmm, vmm_aux);
+            }
+        } else if (load_prc == Precision::I32 && store_prc == Precision::FP32) {
+            uni_vcvtdq2ps(vmm, vmm);
+        }
+
+        if (dst_prc_ == Precision::FP16) {
+            // round to nearest even
+            vcvtps2ph(Vmm_half(vmm.getIdx()), vmm, 0x0);
+            store_emitter->emit_code({idx}, {static_cast<size_t>(reg_dst.getIdx())},
+                std::make_shared<store_emitter_context>(Precision::FP16, Precision::FP16, elt_num, elt_offset * dst_prc_.size()),
+                {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+        } else {
+            store_emitter->emit_code({idx}, {static_cast<size_t>(reg_dst.getIdx())},
+                std::make_shared<store_emitter_context>(store_prc, dst_prc_, elt_num, elt_offset * dst_prc_.size()),
+                {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+        }
+    }
+};
+
+// precisions converted by the JIT kernels, jitPrecisionIndex() gives the index in this list
+const Precision::ePrecision jitPrecisions[] = {
+    Precision::FP32, Precision::BF16, Precision::FP16, Precision::I32, Precision::I16, Precision::U16, Precision::I8, Precision::U8
+};
+constexpr size_t jitPrecisionsNum = sizeof(jitPrecisions) / sizeof(jitPrecisions[0]);
+
+int jitPrecisionIndex(Precision prc) {
+    switch (prc) {
+        case Precision::FP32: return 0;
+        case Precision::BF16: return 1;
+        case Precision::FP16: return 2;
+        case Precision::I32: return 3;
+        case Precision::I16: return 4;
+        case Precision::U16: return 5;
+        case Precision::I8: return 6;
+        case Precision::U8: return 7;
+        default: return -1;
+    }
+}
+
+std::unique_ptr<jit_convert_kernel> createConvertKernel(Precision srcPrc, Precision dstPrc) {
+    // BF16 store is implemented for avx512 only, FP16 conversion instructions are not available on sse41
+    if (dstPrc == Precision::BF16 && !mayiuse(cpu::x64::avx512_core))
+        return nullptr;
+    if ((srcPrc == Precision::FP16 || dstPrc == Precision::FP16) && !mayiuse(cpu::x64::avx2))
+        return nullptr;
+
+    std::unique_ptr<jit_convert_kernel> kernel;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        kernel.reset(new jit_uni_convert_kernel<cpu::x64::avx512_common>(srcPrc, dstPrc));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        kernel.reset(new jit_uni_convert_kernel<cpu::x64::avx2>(srcPrc, dstPrc));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        kernel.reset(new jit_uni_convert_kernel<cpu::x64::sse41>(srcPrc, dstPrc));
+    }
+
+    if (kernel)
+        kernel->create_ker();
+    return kernel;
+}
+
+/**
+ * Kernels of all the precision pairs, they are generated once on the first conversion and then looked up
+ * without locking. nullptr is kept for the pairs which are converted by the reference implementation.
+ */
+class ConvertKernels {
+public:
+    ConvertKernels() {
+        for (size_t src = 0; src < jitPrecisionsNum; src++) {
+            for (size_t dst = 0; dst < jitPrecisionsNum; dst++) {
+                // the same precisions are copied
+                if (src != dst)
+                    kernels[src * jitPrecisionsNum + dst] = createConvertKernel(jitPrecisions[src], jitPrecisions[dst]);
+            }
+        }
+    }
+
+    const jit_convert_kernel* get(Precision srcPrc, Precision dstPrc) const {
+        const int src = jitPrecisionIndex(srcPrc);
+        const int dst = jitPrecisionIndex(dstPrc);
+        if (src < 0 || dst < 0)
+            return nullptr;
+        return kernels[src * jitPrecisionsNum + dst].get();
+    }
+
+    static const ConvertKernels& instance() {
+        static const ConvertKernels convertKernels;
+        return convertKernels;
+    }
+
+private:
+    std::unique_ptr<jit_convert_kernel> kernels[jitPrecisionsNum * jitPrecisionsNum];
+};
+
+bool jitConvert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
+    const auto kernel = ConvertKernels::instance().get(srcPrc, dstPrc);
+    if (!kernel)
+        return false;
+
+    // big enough to amortize the threading overhead, multiple of any vector length
+    const size_t blockSize = 16384;
+    const auto src = reinterpret_cast<const uint8_t *>(srcPtr);
+    const auto dst = reinterpret_cast<uint8_t *>(dstPtr);
+
+    parallel_for((size + blockSize - 1) / blockSize, [&](size_t block) {
+        const size_t offset = block * blockSize;
+        jit_convert_call_args args;
+        args.src = src + offset * srcPrc.size();
+        args.dst = dst + offset * dstPrc.size();
+        args.work_amount = std::min(blockSize, size - offset);
+        (*kernel)(&args);
+    });
+    return true;
+}
+
+template <typename T>
+struct is_float_type : std::is_floating_point<T> {};
+
+template <>
+struct is_float_type<bfloat16_t> : std::true_type {};
+
+template <>
+struct is_float_type<ngraph::float16> : std::true_type {};
+
+// conversion to floating point types goes through FP32
+template <typename dstType, typename srcType,
+          typename std::enable_if<is_float_type<dstType>::value, int>::type = 0>
+dstType saturate_cast(srcType value) {
+    return static_cast<dstType>(static_cast<float>(value));
+}
+
+// truncation towards zero, out of range values are saturated, NaN is converted to the lowest value
+template <typename dstType, typename srcType,
+          typename std::enable_if<!is_float_type<dstType>::value && is_float_type<srcType>::value, int>::type = 0>
+dstType saturate_cast(srcType value) {
+    using limits = std::numeric_limits<dstType>;
+    const float v = static_cast<float>(value);
+    if (!(v > static_cast<float>(limits::lowest())))
+        return limits::lowest();
+    // max values of the types wider than float mantissa are rounded up by the conversion to float
+    if (v >= static_cast<float>(limits::max()))
+        return limits::max();
+    return static_cast<dstType>(v);
+}
+
+template <typename dstType, typename srcType,
+          typename std::enable_if<!is_float_type<dstType>::value && !is_float_type<srcType>::value, int>::type = 0>
+dstType saturate_cast(srcType value) {
+    using limits = std::numeric_limits<dstType>;
+    if (std::is_signed<srcType>::value && static_cast<int64_t>(value) < 0) {
+        return static_cast<int64_t>(value) < static_cast<int64_t>(limits::lowest()) ? limits::lowest() : static_cast<dstType>(value);
+    }
+    return static_cast<uint64_t>(value) > static_cast<uint64_t>(limits::max()) ? limits::max() : static_cast<dstType>(value);
+}
+
 template<typename srcType, typename dstType>
-void convert(const void *srcPtr, void *dstPtr, const size_t size) {
+void convert(const void *srcPtr, void *dstPtr, const size_t size, bool toBoolean) {
     if (std::is_same<srcType, dstType>::value) {
         cpu_memcpy(dstPtr, srcPtr, size*sizeof(dstType));
     } else {
         const srcType *srcData = reinterpret_cast<const srcType *>(srcPtr);
         dstType *dstData = reinterpret_cast<dstType *>(dstPtr);
 
-        parallel_for(size, [&](size_t i) {
-            dstData[i] = static_cast<dstType>(srcData[i]);
-        });
+        if (toBoolean) {
+            parallel_for(size, [&](size_t i) {
+                dstData[i] = static_cast<dstType>(srcData[i]);
+            });
+        } else {
+            parallel_for(size, [&](size_t i) {
+                dstData[i] = saturate_cast<dstType>(srcData[i]);
+            });
+        }
     }
 }
 
@@ -38,10 +391,16 @@ struct PrecisionInfo<Precision::BF16> {
     using value_type = MKLDNNPlugin::bfloat16_t;
 };
 
+template <>
+struct PrecisionInfo<Precision::FP16> {
+    using value_type = ngraph::float16;
+};
+
 struct ConvertContext {
     const void *srcPtr;
     void *dstPtr;
     size_t size;
+    bool toBoolean;
     bool converted;
 };
 
@@ -51,7 +410,7 @@ struct ConvertPrecision {
     using dst_t = typename std::tuple_element<1, T>::type;
 
     void operator()(ConvertContext & ctx) {
-        convert<src_t, dst_t>(ctx.srcPtr, ctx.dstPtr, ctx.size);
+        convert<src_t, dst_t>(ctx.srcPtr, ctx.dstPtr, ctx.size, ctx.toBoolean);
         ctx.converted = true;
     }
 };
@@ -71,39 +430,57 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         return;
     }
 
-    ConvertContext ctx = { srcPtr, dstPtr, size, false };
+    if (jitConvert(srcPtr, dstPtr, srcPrc, dstPrc, size))
+        return;
+
+    // BOOL shares the value type with U8, so the conversion to BOOL is distinguished explicitly and keeps static_cast semantics
+    ConvertContext ctx = { srcPtr, dstPtr, size, dstPrc == Precision::BOOL, false };
 
     OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc),
     MKLDNN_CVT(U8, I8),    MKLDNN_CVT(U8, U16),    MKLDNN_CVT(U8, I16),
     MKLDNN_CVT(U8, I32),   MKLDNN_CVT(U8, U64),    MKLDNN_CVT(U8, I64),
     MKLDNN_CVT(U8, FP32),  MKLDNN_CVT(U8, BF16),   MKLDNN_CVT(U8, BOOL),
+    MKLDNN_CVT(U8, FP16),
     MKLDNN_CVT(I8, U8),    MKLDNN_CVT(I8, U16),    MKLDNN_CVT(I8, I16),
     MKLDNN_CVT(I8, I32),   MKLDNN_CVT(I8, U64),    MKLDNN_CVT(I8, I64),
     MKLDNN_CVT(I8, FP32),  MKLDNN_CVT(I8, BF16),   MKLDNN_CVT(I8, BOOL),
+    MKLDNN_CVT(I8, FP16),
     MKLDNN_CVT(U16, U8),   MKLDNN_CVT(U16, I8),    MKLDNN_CVT(U16, I16),
     MKLDNN_CVT(U16, I32),  MKLDNN_CVT(U16, U64),   MKLDNN_CVT(U16, I64),
     MKLDNN_CVT(U16, FP32), MKLDNN_CVT(U16, BF16),  MKLDNN_CVT(U16, BOOL),
+    MKLDNN_CVT(U16, FP16),
     MKLDNN_CVT(I16, U8),   MKLDNN_CVT(I16, I8),    MKLDNN_CVT(I16, U16),
     MKLDNN_CVT(I16, I32),  MKLDNN_CVT(I16, U64),   MKLDNN_CVT(I16, I64),
     MKLDNN_CVT(I16, FP32), MKLDNN_CVT(I16, BF16),  MKLDNN_CVT(I16, BOOL),
+    MKLDNN_CVT(I16, FP16),
     MKLDNN_CVT(I32, U8),   MKLDNN_CVT(I32, I8),    MKLDNN_CVT(I32, U16),
     MKLDNN_CVT(I32, I16),  MKLDNN_CVT(I32, U64),   MKLDNN_CVT(I32, I64),
     MKLDNN_CVT(I32, FP32), MKLDNN_CVT(I32, BF16),  MKLDNN_CVT(I32, BOOL),
+    MKLDNN_CVT(I32, FP16),
     MKLDNN_CVT(U64, U8),   MKLDNN_CVT(U64, I8),    MKLDNN_CVT(U64, U16),
     MKLDNN_CVT(U64, I16),  MKLDNN_CVT(U64, I32),   MKLDNN_CVT(U64, I64),
     MKLDNN_CVT(U64, FP32), MKLDNN_CVT(U64, BF16),  MKLDNN_CVT(U64, BOOL),
+    MKLDNN_CVT(U64, FP16),
     MKLDNN_CVT(I64, U8),   MKLDNN_CVT(I64, I8),    MKLDNN_CVT(I64, U16),
     MKLDNN_CVT(I64, I16),  MKLDNN_CVT(I64, I32),   MKLDNN_CVT(I64, U64),
     MKLDNN_CVT(I64, FP32), MKLDNN_CVT(I64, BF16),  MKLDNN_CVT(I64, BOOL),
+    MKLDNN_CVT(I64, FP16),
     MKLDNN_CVT(FP32, U8),  MKLDNN_CVT(FP32, I8),   MKLDNN_CVT(FP32, U16),
     MKLDNN_CVT(FP32, I16), MKLDNN_CVT(FP32, I32),  MKLDNN_CVT(FP32, U64),
     MKLDNN_CVT(FP32, I64), MKLDNN_CVT(FP32, BF16), MKLDNN_CVT(FP32, BOOL),
+    MKLDNN_CVT(FP32, FP16),
     MKLDNN_CVT(BF16, U8),  MKLDNN_CVT(BF16, I8),   MKLDNN_CVT(BF16, U16),
     MKLDNN_CVT(BF16, I16), MKLDNN_CVT(BF16, I32),  MKLDNN_CVT(BF16, U64),
     MKLDNN_CVT(BF16, I64), MKLDNN_CVT(BF16, FP32), MKLDNN_CVT(BF16, BOOL),
+    MKLDNN_CVT(BF16, FP16),
+    MKLDNN_CVT(FP16, U8),  MKLDNN_CVT(FP16, I8),   MKLDNN_CVT(FP16, U16),
+    MKLDNN_CVT(FP16, I16), MKLDNN_CVT(FP16, I32),  MKLDNN_CVT(FP16, U64),
+    MKLDNN_CVT(FP16, I64), MKLDNN_CVT(FP16, FP32), MKLDNN_CVT(FP16, BOOL),
+    MKLDNN_CVT(FP16, BF16),
     MKLDNN_CVT(BOOL, U8),  MKLDNN_CVT(BOOL, I8),   MKLDNN_CVT(BOOL, U16),
     MKLDNN_CVT(BOOL, I16), MKLDNN_CVT(BOOL, I32),  MKLDNN_CVT(BOOL, U64),
-    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, BF16));
+    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, BF16),
+    MKLDNN_CVT(BOOL, FP16));
 
     if (!ctx.converted)
         IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
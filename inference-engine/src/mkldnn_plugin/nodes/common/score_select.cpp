@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "score_select.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// maps the float to the unsigned integer with the same ordering
+inline uint32_t radix_key(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if (bits == 0x80000000u)  // -0.0 is equal to 0.0
+        bits = 0;
+    return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+}
+
+// moves top_k indices with the largest keys (the lower index goes first for the equal keys) to the beginning
+void radix_select(const float* scores, int* indices, int count, int top_k) {
+    std::vector<uint32_t> keys(count);
+    for (int i = 0; i < count; i++)
+        keys[i] = radix_key(scores[indices[i]]);
+
+    // find the key prefix of the k-th largest element one byte at a time
+    uint32_t prefix = 0, mask = 0;
+    int needed = top_k;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        int histogram[256] = {};
+        for (int i = 0; i < count; i++) {
+            if ((keys[i] & mask) == prefix)
+                histogram[(keys[i] >> shift) & 0xFF]++;
+        }
+
+        int digit = 255;
+        for (; histogram[digit] < needed; digit--)
+            needed -= histogram[digit];
+
+        prefix |= static_cast<uint32_t>(digit) << shift;
+        mask |= 0xFFu << shift;
+        // all the elements with this prefix are selected, there is no need to look at the lower bytes
+        if (histogram[digit] == needed)
+            break;
+    }
+
+    int selected = 0;
+    for (int i = 0; i < count; i++) {
+        const uint32_t key = keys[i] & mask;
+        if (key > prefix || (key == prefix && needed-- > 0))
+            indices[selected++] = indices[i];
+    }
+}
+
+}  // namespace
+
+int select_top_scores(const float* scores, int num, float threshold, int top_k, int* indices) {
+    int count = 0;
+    for (int i = 0; i < num; i++) {
+        indices[count] = i;
+        count += scores[i] > threshold;
+    }
+
+    if (top_k >= 0 && count > top_k) {
+        if (top_k > 0)
+            radix_select(scores, indices, count, top_k);
+        count = top_k;
+    }
+
+    std::sort(indices, indices + count, [scores](int idx1, int idx2) {
+        return scores[idx1] > scores[idx2] || (scores[idx1] == scores[idx2] && idx1 < idx2);
+    });
+    return count;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,27 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Selects the indices of the scores greater than the threshold and sorts them by the score in descending order,
+ * the lower index goes first for the equal scores. If top_k is not negative, only top_k best indices are kept:
+ * they are found with the radix selection in linear time, so only the selected part is sorted.
+ * @param scores
+ * scores to select from
+ * @param num
+ * number of the scores
+ * @param threshold
+ * scores not greater than the threshold are skipped
+ * @param top_k
+ * maximum number of the indices to select, negative means no limit
+ * @param indices
+ * selected indices, should have room for num elements
+ * @return number of the selected indices
+ */
+int select_top_scores(const float* scores, int num, float threshold, int top_k, int* indices);
+
+}  // namespace MKLDNNPlugin
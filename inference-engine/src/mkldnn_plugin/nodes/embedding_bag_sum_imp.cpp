@@ -0,0 +1,256 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_sum_imp.hpp"
+
+#include <cstring>
+#include <algorithm>
+#include <ie_common.h>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// the rows are accumulated by chunks, so the accumulator stays in L1 for any depth
+constexpr size_t chunk_size = 256;
+// number of the rows ahead to prefetch
+constexpr size_t prefetch_distance = 4;
+
+template <typename T>
+struct acc_type {
+    using type = int32_t;
+};
+
+template <>
+struct acc_type<float> {
+    using type = float;
+};
+
+// bfloat16
+template <>
+struct acc_type<uint16_t> {
+    using type = float;
+};
+
+inline float to_acc(float value) {
+    return value;
+}
+
+inline float to_acc(uint16_t value) {
+    const uint32_t bits = static_cast<uint32_t>(value) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+inline int32_t to_acc(int32_t value) {
+    return value;
+}
+
+inline int32_t to_acc(int8_t value) {
+    return value;
+}
+
+inline int32_t to_acc(uint8_t value) {
+    return value;
+}
+
+// the 8-bit sums wrap around to the type: the low bits of the I32 sum are the ones of the reference summing in the type
+template <typename T>
+inline T from_acc(typename acc_type<T>::type value) {
+    return static_cast<T>(value);
+}
+
+// rounding to the nearest even as bfloat16_t does
+template <>
+inline uint16_t from_acc<uint16_t>(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return static_cast<uint16_t>((bits + ((bits & 0x00010000) >> 1)) >> 16);
+}
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vec_width = 16;
+using vecf = __m512;
+using veci = __m512i;
+
+inline vecf vload_acc(const float* ptr) { return _mm512_loadu_ps(ptr); }
+inline vecf vload_acc(const uint16_t* ptr) {
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));
+}
+inline veci vload_acc(const int32_t* ptr) { return _mm512_loadu_si512(ptr); }
+inline veci vload_acc(const int8_t* ptr) { return _mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))); }
+inline veci vload_acc(const uint8_t* ptr) { return _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))); }
+inline void vstore(float* ptr, vecf v) { _mm512_storeu_ps(ptr, v); }
+inline void vstore(int32_t* ptr, veci v) { _mm512_storeu_si512(ptr, v); }
+inline vecf vset1(float value) { return _mm512_set1_ps(value); }
+inline veci vset1(int32_t value) { return _mm512_set1_epi32(value); }
+inline vecf vadd(vecf a, vecf b) { return _mm512_add_ps(a, b); }
+inline veci vadd(veci a, veci b) { return _mm512_add_epi32(a, b); }
+inline vecf vmul(vecf a, vecf b) { return _mm512_mul_ps(a, b); }
+inline veci vmul(veci a, veci b) { return _mm512_mullo_epi32(a, b); }
+#elif defined(HAVE_AVX2)
+constexpr size_t vec_width = 8;
+using vecf = __m256;
+using veci = __m256i;
+
+inline vecf vload_acc(const float* ptr) { return _mm256_loadu_ps(ptr); }
+inline vecf vload_acc(const uint16_t* ptr) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))), 16));
+}
+inline veci vload_acc(const int32_t* ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+inline veci vload_acc(const int8_t* ptr) { return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr))); }
+inline veci vload_acc(const uint8_t* ptr) { return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr))); }
+inline void vstore(float* ptr, vecf v) { _mm256_storeu_ps(ptr, v); }
+inline void vstore(int32_t* ptr, veci v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), v); }
+inline vecf vset1(float value) { return _mm256_set1_ps(value); }
+inline veci vset1(int32_t value) { return _mm256_set1_epi32(value); }
+inline vecf vadd(vecf a, vecf b) { return _mm256_add_ps(a, b); }
+inline veci vadd(veci a, veci b) { return _mm256_add_epi32(a, b); }
+inline vecf vmul(vecf a, vecf b) { return _mm256_mul_ps(a, b); }
+inline veci vmul(veci a, veci b) { return _mm256_mullo_epi32(a, b); }
+#elif defined(HAVE_SSE42)
+constexpr size_t vec_width = 4;
+using vecf = __m128;
+using veci = __m128i;
+
+inline int32_t load_4_bytes(const void* ptr) {
+    int32_t bytes;
+    std::memcpy(&bytes, ptr, sizeof(bytes));
+    return bytes;
+}
+
+inline vecf vload_acc(const float* ptr) { return _mm_loadu_ps(ptr); }
+inline vecf vload_acc(const uint16_t* ptr) {
+    return _mm_castsi128_ps(_mm_slli_epi32(_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr))), 16));
+}
+inline veci vload_acc(const int32_t* ptr) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); }
+inline veci vload_acc(const int8_t* ptr) { return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(load_4_bytes(ptr))); }
+inline veci vload_acc(const uint8_t* ptr) { return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(load_4_bytes(ptr))); }
+inline void vstore(float* ptr, vecf v) { _mm_storeu_ps(ptr, v); }
+inline void vstore(int32_t* ptr, veci v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), v); }
+inline vecf vset1(float value) { return _mm_set1_ps(value); }
+inline veci vset1(int32_t value) { return _mm_set1_epi32(value); }
+inline vecf vadd(vecf a, vecf b) { return _mm_add_ps(a, b); }
+inline veci vadd(veci a, veci b) { return _mm_add_epi32(a, b); }
+inline vecf vmul(vecf a, vecf b) { return _mm_mul_ps(a, b); }
+inline veci vmul(veci a, veci b) { return _mm_mullo_epi32(a, b); }
+#endif
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+template <typename T>
+inline void prefetch_row(const T* row, size_t size) {
+    const char* ptr = reinterpret_cast<const char*>(row);
+    for (size_t offset = 0; offset < size * sizeof(T); offset += 64)
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+}
+#else
+template <typename T>
+inline void prefetch_row(const T*, size_t) {}
+#endif
+
+template <bool weighted, typename T, typename A>
+inline void accumulate_row(A* acc, const T* row, A weight, size_t size) {
+    size_t j = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const auto vweight = vset1(weight);
+    for (; j + vec_width <= size; j += vec_width) {
+        auto value = vload_acc(row + j);
+        if (weighted)
+            value = vmul(value, vweight);
+        vstore(acc + j, vadd(vload_acc(acc + j), value));
+    }
+#endif
+    for (; j < size; j++)
+        acc[j] += weighted ? to_acc(row[j]) * weight : to_acc(row[j]);
+}
+
+// the first rows of the chunk of the bag
+template <typename T>
+inline void prefetch_bag(const T* table, const emb_bag& bag, size_t depth, size_t start, size_t size) {
+    const size_t num = bag.indices ? std::min(prefetch_distance, bag.size) : 0;
+    for (size_t i = 0; i < num; i++)
+        prefetch_row(table + static_cast<size_t>(bag.indices[i]) * depth + start, size);
+}
+
+template <typename T>
+void emb_bag_sum_impl(const T* table, const T* weights, const emb_bag* bags, size_t num_bags, T* dst, size_t depth) {
+    using A = typename acc_type<T>::type;
+    A acc[chunk_size];
+
+    if (num_bags > 0)
+        prefetch_bag(table, bags[0], depth, 0, std::min(chunk_size, depth));
+
+    for (size_t b = 0; b < num_bags; b++) {
+        const emb_bag& bag = bags[b];
+        const size_t num = bag.indices ? bag.size : 0;
+        T* dst_row = dst + b * depth;
+
+        for (size_t start = 0; start < depth; start += chunk_size) {
+            const size_t size = std::min(chunk_size, depth - start);
+            std::fill(acc, acc + size, A(0));
+
+            // small bags are common, so the rows of the next chunk or the next bag are requested in advance
+            if (start + chunk_size < depth)
+                prefetch_bag(table, bag, depth, start + chunk_size, std::min(chunk_size, depth - start - chunk_size));
+            else if (b + 1 < num_bags)
+                prefetch_bag(table, bags[b + 1], depth, 0, std::min(chunk_size, depth));
+
+            for (size_t i = 0; i < num; i++) {
+                if (i + prefetch_distance < num)
+                    prefetch_row(table + static_cast<size_t>(bag.indices[i + prefetch_distance]) * depth + start, size);
+
+                const T* row = table + static_cast<size_t>(bag.indices[i]) * depth + start;
+                if (bag.weights_offset >= 0)
+                    accumulate_row<true>(acc, row, to_acc(weights[bag.weights_offset + i]), size);
+                else
+                    accumulate_row<false>(acc, row, A(1), size);
+            }
+
+            for (size_t j = 0; j < size; j++)
+                dst_row[start + j] = from_acc<T>(acc[j]);
+        }
+    }
+}
+
+template <typename T>
+void emb_bag_sum_typed(const uint8_t* table, const uint8_t* weights, const emb_bag* bags, size_t num_bags, uint8_t* dst, size_t depth) {
+    emb_bag_sum_impl(reinterpret_cast<const T*>(table), reinterpret_cast<const T*>(weights), bags, num_bags,
+                     reinterpret_cast<T*>(dst), depth);
+}
+
+}  // namespace
+
+void emb_bag_sum(const uint8_t* table, const uint8_t* weights, const emb_bag* bags, size_t num_bags, uint8_t* dst, const emb_bag_conf& conf) {
+    switch (conf.precision) {
+        case Precision::FP32:
+            emb_bag_sum_typed<float>(table, weights, bags, num_bags, dst, conf.depth);
+            break;
+        case Precision::BF16:
+            emb_bag_sum_typed<uint16_t>(table, weights, bags, num_bags, dst, conf.depth);
+            break;
+        case Precision::I32:
+            emb_bag_sum_typed<int32_t>(table, weights, bags, num_bags, dst, conf.depth);
+            break;
+        case Precision::I8:
+            emb_bag_sum_typed<int8_t>(table, weights, bags, num_bags, dst, conf.depth);
+            break;
+        case Precision::U8:
+            emb_bag_sum_typed<uint8_t>(table, weights, bags, num_bags, dst, conf.depth);
+            break;
+        default:
+            IE_THROW() << "EmbeddingBagSum doesn't support precision " << Precision(conf.precision).name();
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
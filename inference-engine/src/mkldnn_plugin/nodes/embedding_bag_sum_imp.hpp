@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ie_precision.hpp>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct emb_bag_conf {
+    // precision of the table, the per-sample weights and the output: FP32, BF16, I32, I8 or U8
+    Precision::ePrecision precision;
+    // number of the elements in a table row
+    size_t depth;
+};
+
+struct emb_bag {
+    // indices of the table rows, nullptr for the empty bag
+    const int* indices;
+    size_t size;
+    // offset of the per-sample weights of the bag, negative if the rows are not weighted
+    int weights_offset;
+};
+
+namespace XARCH {
+
+/**
+ * @brief Computes the sums of the table rows of the bags, the rows are optionally multiplied by the per-sample weights.
+ * FP32 and BF16 rows are accumulated in FP32, the integer ones are accumulated in I32. The I8 and U8 sums wrap around
+ * to the range of the type as the ngraph reference does. The rows of the following indices are prefetched while the
+ * current one is accumulated.
+ * @param table
+ * embedding table
+ * @param weights
+ * per-sample weights, may be nullptr if no bag is weighted
+ * @param bags
+ * bags to compute
+ * @param num_bags
+ * number of the bags
+ * @param dst
+ * output rows of the bags
+ * @param conf
+ * precision and the row size
+ */
+
+void emb_bag_sum(const uint8_t* table, const uint8_t* weights, const emb_bag* bags, size_t num_bags, uint8_t* dst, const emb_bag_conf& conf);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -9,6 +9,8 @@
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_detection_output_node.h"
+#include "common/box_nms.hpp"
+#include "common/score_select.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -206,32 +208,31 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
 
     memset(detections_data, 0, N*_num_classes*sizeof(int));
 
+    if (!_decrease_label_id) {
+        // Caffe style, the classes of all the images are processed independently
+        parallel_for2d(N, _num_classes, [&](int n, int c) {
+            if (c != _background_label_id) {  // Ignore background class
+                int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                int *pdetections = detections_data + n*_num_classes + c;
+
+                const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                const float *pboxes;
+                if (_share_location) {
+                    pboxes = decoded_bboxes_data + n*4*_num_priors;
+                } else {
+                    pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                }
+
+                nms_cf(pconf, pboxes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+            }
+        });
+    }
+
     for (int n = 0; n < N; ++n) {
         int detections_total = 0;
 
-        if (!_decrease_label_id) {
-            // Caffe style
-            parallel_for(_num_classes, [&](int c) {
-                if (c != _background_label_id) {  // Ignore background class
-                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                    int *pbuffer     = buffer_data + c*_num_priors;
-                    int *pdetections = detections_data + n*_num_classes + c;
-
-                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                    const float *pboxes;
-                    const float *psizes;
-                    if (_share_location) {
-                        pboxes = decoded_bboxes_data + n*4*_num_priors;
-                        psizes = bbox_sizes_data + n*_num_priors;
-                    } else {
-                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                    }
-
-                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
-                }
-            });
-        } else {
+        if (_decrease_label_id) {
             // MXNet style
             int *pindices = indices_data + n*_num_classes*_num_priors;
             int *pbuffer = buffer_data;
@@ -498,42 +499,15 @@ void MKLDNNDetectionOutputNode::decodeBBoxes(const float *prior_data,
 
 void MKLDNNDetectionOutputNode::nms_cf(const float* conf_data,
                                  const float* bboxes,
-                                 const float* sizes,
                                  int* buffer,
                                  int* indices,
                                  int& detections,
                                  int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
-    }
-
-    int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
+    const int num_output_scores = select_top_scores(conf_data, num_priors_actual, _confidence_threshold, _top_k, buffer);
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
-
-    for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
-    }
+    const Extensions::Cpu::nms_conf conf = {_nms_threshold, 0.f, false};
+    detections = Extensions::Cpu::XARCH::nms_boxes(bboxes, bboxes + 1, bboxes + 2, bboxes + 3, 4,
+                                                   buffer, num_output_scores, -1, conf, indices);
 }
 
 void MKLDNNDetectionOutputNode::nms_mx(const float* conf_data,
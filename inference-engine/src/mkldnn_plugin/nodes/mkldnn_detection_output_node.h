@@ -66,7 +66,7 @@ private:
                       float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
                       bool decodeType = true); // after ARM = false
 
-    void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
+    void nms_cf(const float *conf_data, const float *bboxes,
                 int *buffer, int *indices, int &detections, int num_priors_actual);
 
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
@@ -12,6 +12,7 @@
 #include <cpu/ref_eltwise.hpp>
 
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_kernel_cache.hpp"
 #include "mkldnn_fake_quantize_node.h"
 #include "mkldnn_pooling_node.h"
 #include "mkldnn_input_node.h"
@@ -764,6 +765,39 @@ private:
     }
 };
 
+static void appendEltwiseParams(MKLDNNKernelKey& key, const MKLDNNEltwiseNode& node) {
+    key << node.getAlgorithm() << static_cast<int>(node.getMKLDNNAlgorithm()) << node.getAlpha() << node.getBeta() << node.getGamma();
+}
+
+// The kernel reads the node and its fused nodes while generating the code only, so it is shared with the nodes
+// of the same algorithms and scalars. The kernels of the fused FakeQuantize nodes aren't shared
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_eltwise_kernel> createEltwiseKernel(const jit_eltwise_params& jep, MKLDNNEltwiseNode& node) {
+    auto create = [&] {
+        std::shared_ptr<jit_uni_eltwise_kernel> kernel(new jit_uni_eltwise_generic<isa>(jep, node));
+        kernel->create_ker();
+        return kernel;
+    };
+
+    MKLDNNKernelKey key("eltwise");
+    key << isa << jep.inputs_number << jep.input_size << jep.dst_prc << jep.dst_size << jep.oc_size;
+    for (size_t i = 0; i < jep.inputs_number; i++) {
+        key << jep.src_prc[i] << jep.src_size[i];
+        for (auto offset : jep.src_offsets[i])
+            key << offset;
+    }
+    for (auto offset : jep.dst_offsets)
+        key << offset;
+    appendEltwiseParams(key, node);
+    for (const auto& fusedNode : node.getFusedWith()) {
+        auto fusedEltwise = dynamic_cast<const MKLDNNEltwiseNode*>(fusedNode.get());
+        if (fusedEltwise == nullptr)
+            return create();
+        appendEltwiseParams(key, *fusedEltwise);
+    }
+    return MKLDNNKernelCache::get()->getOrCreate<jit_uni_eltwise_kernel>(key, create);
+}
+
 std::map<const ngraph::DiscreteTypeInfo, std::function<void(const std::shared_ptr<ngraph::Node>&, MKLDNNEltwiseNode& node)>> MKLDNNEltwiseNode::initializers = {
     {ngraph::op::v1::Add::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
         node.algorithm = EltwiseAdd;
@@ -1395,15 +1429,12 @@ void MKLDNNEltwiseNode::createPrimitive() {
     jep.oc_size = oc_size;
 
     if (mayiuse(x64::avx512_common)) {
-        eltwise_kernel.reset(new jit_uni_eltwise_generic<x64::avx512_common>(jep, *this));
+        eltwise_kernel = createEltwiseKernel<x64::avx512_common>(jep, *this);
     } else if (mayiuse(x64::avx2)) {
-        eltwise_kernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep, *this));
+        eltwise_kernel = createEltwiseKernel<x64::avx2>(jep, *this);
     } else if (mayiuse(x64::sse41)) {
-        eltwise_kernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, *this));
+        eltwise_kernel = createEltwiseKernel<x64::sse41>(jep, *this);
     }
-
-    if (eltwise_kernel)
-        eltwise_kernel->create_ker();
 }
 
 void MKLDNNEltwiseNode::selectOptimalPrimitiveDescriptor() {
@@ -5,11 +5,13 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include "ie_parallel.hpp"
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/general_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -42,100 +44,61 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
-template<typename T>
-void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
-                                            const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
+void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                                        const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
+    const auto precision = srcDesc.getPrecision();
+    if (!one_of(precision, Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32)) {
+        IE_THROW() << "EmbeddingBagSum layer does not support precision '"
+                    + std::string(precision.name()) + "'";
+    }
+
     initFromInputs();
 
-    const auto& inDataDims = srcDesc.getDims();
+    const size_t tableRows = srcDesc.getDims()[0];
     const size_t outputBagsNum = dstDesc.getDims()[0];
+    _bags.resize(outputBagsNum);
+    _bagCosts.resize(outputBagsNum + 1);
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-
-        size_t indicesSize = 0lu;
+    parallel_for(outputBagsNum, [&](size_t obi) {
         const int* indices = nullptr;
-        int weightsIdx = 0lu;
+        size_t indicesSize = 0lu;
+        int weightsIdx = 0;
         bool withWeights = _withWeights;
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                }
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
+        if (indices == nullptr)
+            indicesSize = 0lu;
+        for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+            if (indices[inIdx] < 0 || static_cast<size_t>(indices[inIdx]) >= tableRows) {
+                IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
             }
         }
+        _bags[obi] = {indices, indicesSize, withWeights && _withWeights ? weightsIdx : -1};
+    });
+
+    // every bag costs its rows and the output row
+    _bagCosts[0] = 0lu;
+    for (size_t obi = 0lu; obi < outputBagsNum; obi++)
+        _bagCosts[obi + 1] = _bagCosts[obi] + _bags[obi].size + 1lu;
+
+    const Extensions::Cpu::emb_bag_conf conf = {precision, _embDepth};
+    const size_t dstRowSize = _embDepth * precision.size();
+
+    // the bags are split by the cost rather than by the number, so skewed bag sizes don't leave threads idle
+    auto threadBody = [&](const int ithr, const int nthr) {
+        const size_t totalCost = _bagCosts.back();
+        auto bagAt = [&](size_t cost) {
+            return static_cast<size_t>(std::lower_bound(_bagCosts.begin(), _bagCosts.end(), cost) - _bagCosts.begin());
+        };
+        const size_t start = bagAt(totalCost * ithr / nthr);
+        const size_t end = bagAt(totalCost * (ithr + 1) / nthr);
+        if (start >= end)
+            return;
+
+        Extensions::Cpu::XARCH::emb_bag_sum(srcData, weightsData, &_bags[start], end - start, dstData + start * dstRowSize, conf);
     };
 
     parallel_nt(0, threadBody);
 }
-
-void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
-                                        const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
-    switch (srcDesc.getPrecision()) {
-        case Precision::FP32: {
-            return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
-                    reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), srcDesc, dstDesc);
-        }
-        case Precision::I8: {
-            return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
-                    reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), srcDesc, dstDesc);
-        }
-        case Precision::U8: {
-            return processData<PrecisionTrait<Precision::U8>::value_type>(srcData, weightsData, dstData, srcDesc, dstDesc);
-        }
-        case Precision::I32: {
-            return processData<PrecisionTrait<Precision::I32>::value_type>(reinterpret_cast<const int32_t*>(srcData),
-                    reinterpret_cast<const int32_t*>(weightsData), reinterpret_cast<int32_t*>(dstData), srcDesc, dstDesc);
-        }
-        default: {
-            IE_THROW() << "EmbeddingBagSum layer does not support precision '"
-                        + std::string(srcDesc.getPrecision().name()) + "'";
-        }
-    }
-}
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "embedding_bag_sum_imp.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -35,10 +36,6 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    template<typename T>
-    void processData(const T* srcData, const T* weightsData, T* dstData,
-                     const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc);
-
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
     const size_t PER_SAMPLE_WEIGHTS_IDX;
@@ -47,6 +44,11 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+private:
+    std::vector<InferenceEngine::Extensions::Cpu::emb_bag> _bags;
+    // prefix sums of the bag costs used to balance the threads
+    std::vector<size_t> _bagCosts;
 };
 
 }  // namespace MKLDNNPlugin
@@ -47,11 +47,9 @@ void MKLDNNEmbeddingSegmentsSumNode::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -87,6 +85,18 @@ void MKLDNNEmbeddingSegmentsSumNode::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
+
+    // one pass over the segment ids instead of a pass per segment
+    segmentFirst_.assign(numSegments_ > 0 ? numSegments_ : 0, -1);
+    segmentSize_.assign(segmentFirst_.size(), 0lu);
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const int segment = segmentIds_[si];
+        if (segment < 0 || segment >= numSegments_)
+            continue;
+        if (segmentFirst_[segment] < 0)
+            segmentFirst_[segment] = static_cast<int>(si);
+        segmentSize_[segment]++;
+    }
 }
 
 void MKLDNNEmbeddingSegmentsSumNode::getIndices(int embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -97,14 +107,10 @@ void MKLDNNEmbeddingSegmentsSumNode::getIndices(int embIndex, const int*& indice
     size = 0;
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    if (segmentSize_[embIndex] != 0) {
+        size = segmentSize_[embIndex];
+        indices = indices_ + segmentFirst_[embIndex];
+        weightsIdx = segmentFirst_[embIndex];
     }
 
     // Empty bag
@@ -39,6 +39,10 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    // the first index and the number of the indices of every segment
+    std::vector<int> segmentFirst_;
+    std::vector<size_t> segmentSize_;
 };
 
 }  // namespace MKLDNNPlugin
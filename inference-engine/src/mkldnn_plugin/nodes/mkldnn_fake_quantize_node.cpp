@@ -9,6 +9,7 @@
 #include <math.h>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.hpp"
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
 
@@ -817,6 +818,17 @@ private:
     }
 };
 
+template <template <cpu_isa_t> class Kernel, cpu_isa_t isa>
+static std::shared_ptr<jit_uni_quantize_kernel> createQuantizeKernel(const std::string& name, const jit_quantize_params& jqp) {
+    MKLDNNKernelKey key(name);
+    key << isa << jqp.c << jqp.src_prc << jqp.wei_prc << jqp.dst_prc << jqp.src_layout << jqp.op_type;
+    return MKLDNNKernelCache::get()->getOrCreate<jit_uni_quantize_kernel>(key, [&] {
+        std::shared_ptr<jit_uni_quantize_kernel> kernel(new Kernel<isa>(jqp));
+        kernel->create_ker();
+        return kernel;
+    });
+}
+
 bool MKLDNNFakeQuantizeNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto fq = std::dynamic_pointer_cast<const ngraph::opset1::FakeQuantize>(op);
@@ -1240,23 +1252,21 @@ void MKLDNNFakeQuantizeNode::createPrimitive() {
     if (selectedPrimitiveDescriptor->getImplementationType() != impl_desc_type::ref) {
         if (mayiuse(cpu::x64::avx512_common)) {
             if (isBinarization())
-                quantize_kernel.reset(new jit_uni_binarization_kernel<cpu::x64::avx512_common>(jqp));
+                quantize_kernel = createQuantizeKernel<jit_uni_binarization_kernel, cpu::x64::avx512_common>("binarization", jqp);
             else
-                quantize_kernel.reset(new jit_uni_quantization_kernel<cpu::x64::avx512_common>(jqp));
+                quantize_kernel = createQuantizeKernel<jit_uni_quantization_kernel, cpu::x64::avx512_common>("quantization", jqp);
         } else if (mayiuse(cpu::x64::avx2)) {
             if (isBinarization())
-                quantize_kernel.reset(new jit_uni_binarization_kernel<cpu::x64::avx2>(jqp));
+                quantize_kernel = createQuantizeKernel<jit_uni_binarization_kernel, cpu::x64::avx2>("binarization", jqp);
             else
-                quantize_kernel.reset(new jit_uni_quantization_kernel<cpu::x64::avx2>(jqp));
+                quantize_kernel = createQuantizeKernel<jit_uni_quantization_kernel, cpu::x64::avx2>("quantization", jqp);
         } else if (mayiuse(cpu::x64::sse41)) {
             if (isBinarization())
-                quantize_kernel.reset(new jit_uni_binarization_kernel<cpu::x64::sse41>(jqp));
+                quantize_kernel = createQuantizeKernel<jit_uni_binarization_kernel, cpu::x64::sse41>("binarization", jqp);
             else
-                quantize_kernel.reset(new jit_uni_quantization_kernel<cpu::x64::sse41>(jqp));
+                quantize_kernel = createQuantizeKernel<jit_uni_quantization_kernel, cpu::x64::sse41>("quantization", jqp);
         }
     }
-    if (quantize_kernel)
-        quantize_kernel->create_ker();
 
     size_t axisSize = getParentEdgeAt(0)->getDims()[getAxis()];
     size_t axisPaddedSize = rnd_up(axisSize, 16);
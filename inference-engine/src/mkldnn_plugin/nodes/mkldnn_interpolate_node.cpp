@@ -11,6 +11,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.hpp"
 #include "ie_parallel.hpp"
 #include <algorithm>
 
@@ -1601,6 +1602,23 @@ private:
     }
 };
 
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_interpolate_kernel> createInterpolateKernel(const jit_interpolate_config_params& jcp,
+                                                                           const mkldnn_primitive_attr& attr) {
+    auto create = [&] {
+        std::shared_ptr<jit_uni_interpolate_kernel> kernel(new jit_uni_interpolate_kernel_f32<isa>(jcp, attr));
+        kernel->create_ker();
+        return kernel;
+    };
+    MKLDNNKernelKey key("interpolate");
+    key << isa << static_cast<int>(jcp.layout) << static_cast<int>(jcp.mode) << static_cast<int>(jcp.src_dt)
+        << static_cast<int>(jcp.dst_dt) << jcp.src_data_size << jcp.dst_data_size << jcp.indices_size << jcp.spatial_dim_size
+        << jcp.ID << jcp.IH << jcp.IW << jcp.OD << jcp.OH << jcp.OW;
+    if (!key.appendPostOps(attr))
+        return create();
+    return MKLDNNKernelCache::get()->getOrCreate<jit_uni_interpolate_kernel>(key, create);
+}
+
 // shapeND: n     c     d     h    w
 // blockND: ncdhw cdhw  dhw   hw   w    1
 // index  : 0      1    2     3    4    5
@@ -2021,20 +2039,18 @@ void MKLDNNInterpolateNode::createPrimitive() {
     if (mode == InterpolateMode::nearest || mode == InterpolateMode::linear_onnx || mode == InterpolateMode::cubic) {
         if (jcp.layout != InterpolateLayoutType::planar) {
             if (mayiuse(cpu::x64::avx512_common)) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+                interpolateKernel = createInterpolateKernel<cpu::x64::avx512_common>(jcp, *attr.get());
             } else if (mayiuse(cpu::x64::avx2)) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+                interpolateKernel = createInterpolateKernel<cpu::x64::avx2>(jcp, *attr.get());
             } else if (mayiuse(cpu::x64::sse41)) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
+                interpolateKernel = createInterpolateKernel<cpu::x64::sse41>(jcp, *attr.get());
             }
         } else {
             // gather ISA(for planar JIT kernel) for avx2 and fp32
             if (mayiuse(cpu::x64::avx2) && inputPrec == Precision::FP32) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+                interpolateKernel = createInterpolateKernel<cpu::x64::avx2>(jcp, *attr.get());
             }
         }
-        if (interpolateKernel)
-            interpolateKernel->create_ker();
     }
 
     // build indices table
@@ -110,6 +110,11 @@ void MKLDNNMemoryInputNode::createPrimitive() {
 
     // default memory state is zero filled
     dataStore->FillZero();
+
+    currentState = std::make_shared<MKLDNNMemory>(getEngine());
+    currentState->Create(mem_desc, dataStore->GetData(), false);
+    nextState = std::make_shared<MKLDNNMemory>(getEngine());
+    nextState->Create(mem_desc, dataStore->GetData(), false);
 }
 
 /**
@@ -142,7 +147,12 @@ void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*nextState, new_state);
+}
+
+void MKLDNNMemoryInputNode::bindState(void* current, void* next) {
+    currentState->GetPrimitivePtr()->set_data_handle_no_pads_proc(current);
+    nextState->GetPrimitivePtr()->set_data_handle_no_pads_proc(next);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
@@ -150,7 +160,7 @@ void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    simple_copy(dst_mem, *currentState);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
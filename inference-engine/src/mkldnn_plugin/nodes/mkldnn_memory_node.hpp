@@ -96,8 +96,15 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+    /**
+     * @brief Makes the node read the state from the current buffer and write the next state into the next one.
+     * By default both point to the node's own store
+     */
+    void bindState(void* current, void* next);
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr currentState;
+    MKLDNNMemoryPtr nextState;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
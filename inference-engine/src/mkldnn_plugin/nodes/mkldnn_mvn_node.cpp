@@ -11,6 +11,7 @@
 #include "mkldnn_fake_quantize_node.h"
 #include "mkldnn_eltwise_node.h"
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.hpp"
 #include "utils/bfloat16.hpp"
 #include "ie_parallel.hpp"
 #include "emitters/jit_load_store_emitters.hpp"
@@ -599,6 +600,35 @@ private:
         }
     }
 };
+
+static MKLDNNKernelKey mvnKernelKey(const std::string& name, cpu_isa_t isa, const jit_mvn_config_params& jcp) {
+    MKLDNNKernelKey key(name);
+    key << isa << jcp.planar_layout << jcp.across_channels << jcp.normalize_variance << jcp.src_prc << jcp.dst_prc
+        << jcp.src_data_size << jcp.dst_data_size << jcp.C << jcp.D << jcp.H << jcp.W;
+    return key;
+}
+
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_mvn_kernel> createMVNKernel(const jit_mvn_config_params& jcp, const mkldnn_primitive_attr& attr) {
+    auto create = [&] {
+        std::shared_ptr<jit_uni_mvn_kernel> kernel(new jit_uni_mvn_kernel_f32<isa>(jcp, attr));
+        kernel->create_ker();
+        return kernel;
+    };
+    auto key = mvnKernelKey("mvn", isa, jcp);
+    if (!key.appendPostOps(attr))
+        return create();
+    return MKLDNNKernelCache::get()->getOrCreate<jit_uni_mvn_kernel>(key, create);
+}
+
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_mvn_mean_variance_kernel> createMVNMeanVarianceKernel(const jit_mvn_config_params& jcp) {
+    return MKLDNNKernelCache::get()->getOrCreate<jit_uni_mvn_mean_variance_kernel>(mvnKernelKey("mvn_mean_variance", isa, jcp), [&] {
+        std::shared_ptr<jit_uni_mvn_mean_variance_kernel> kernel(new jit_uni_mvn_mean_variance_kernel_f32<isa>(jcp));
+        kernel->create_ker();
+        return kernel;
+    });
+}
 //////////////////////////////////////////////////////////////////////////////////
 
 bool MKLDNNMVNNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -820,42 +850,33 @@ void MKLDNNMVNNode::createPrimitive() {
     std::tie(N, jcp.C, jcp.D, jcp.H, jcp.W) = shape5D;
 
     if (mayiuse(cpu::x64::avx512_common)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+        mvn_kernel = createMVNKernel<cpu::x64::avx512_common>(jcp, *attr.get());
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
+        mvn_mean_kernel = createMVNMeanVarianceKernel<cpu::x64::avx512_common>(jcp);
         if (normalizeVariance_) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
+            mvn_variance_kernel = createMVNMeanVarianceKernel<cpu::x64::avx512_common>(jcp);
         }
     } else if (mayiuse(cpu::x64::avx2)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+        mvn_kernel = createMVNKernel<cpu::x64::avx2>(jcp, *attr.get());
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
+        mvn_mean_kernel = createMVNMeanVarianceKernel<cpu::x64::avx2>(jcp);
         if (normalizeVariance_) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
+            mvn_variance_kernel = createMVNMeanVarianceKernel<cpu::x64::avx2>(jcp);
         }
     } else if (mayiuse(cpu::x64::sse41)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
+        mvn_kernel = createMVNKernel<cpu::x64::sse41>(jcp, *attr.get());
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
+        mvn_mean_kernel = createMVNMeanVarianceKernel<cpu::x64::sse41>(jcp);
         if (normalizeVariance_) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
+            mvn_variance_kernel = createMVNMeanVarianceKernel<cpu::x64::sse41>(jcp);
         }
     }
-
-    if (mvn_kernel)
-        mvn_kernel->create_ker();
-
-    if (mvn_mean_kernel)
-        mvn_mean_kernel->create_ker();
-
-    if (mvn_variance_kernel)
-        mvn_variance_kernel->create_ker();
 }
 
 void MKLDNNMVNNode::transformTo5DCase(const SizeVector& shape) {
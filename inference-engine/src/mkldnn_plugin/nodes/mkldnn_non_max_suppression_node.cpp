@@ -13,6 +13,8 @@
 #include "ie_parallel.hpp"
 #include <ngraph_ops/nms_ie_internal.hpp>
 #include "utils/general_utils.h"
+#include "common/box_nms.hpp"
+#include "common/score_select.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -335,41 +337,43 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
 
 void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
                                                                 const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
+    // corners of the boxes [x0, y0, x1, y1] are shared by all the classes of the batch
+    std::vector<float> corners(num_batches * num_boxes * 4);
+    parallel_for2d(num_batches, num_boxes, [&](size_t batch_idx, size_t box_idx) {
+        const float *box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+        float *corner = &corners[(batch_idx * num_boxes + box_idx) * 4];
+        if (boxEncodingType == boxEncoding::CENTER) {
+            //  box format: x_center, y_center, width, height
+            corner[0] = box[0] - box[2] / 2.f;
+            corner[1] = box[1] - box[3] / 2.f;
+            corner[2] = box[0] + box[2] / 2.f;
+            corner[3] = box[1] + box[3] / 2.f;
+        } else {
+            //  box format: y1, x1, y2, x2
+            corner[0] = (std::min)(box[1], box[3]);
+            corner[1] = (std::min)(box[0], box[2]);
+            corner[2] = (std::max)(box[1], box[3]);
+            corner[3] = (std::max)(box[0], box[2]);
+        }
+    });
+
+    const Extensions::Cpu::nms_conf conf = {iou_threshold, 0.f, true};
     int max_out_box = static_cast<int>(max_output_boxes_per_class);
     parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+        const float *cornersPtr = &corners[batch_idx * num_boxes * 4];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::vector<std::pair<float, int>> sorted_boxes;
-        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-            if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
-
-        int io_selection_size = 0;
-        if (sorted_boxes.size() > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
-            int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                bool box_is_selected = true;
-                for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                }
-
-                if (box_is_selected) {
-                    filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                    io_selection_size++;
-                }
-            }
+        std::vector<int> sorted_boxes(num_boxes);
+        std::vector<int> selected_boxes(std::min(num_boxes, max_output_boxes_per_class));
+        const int num_sorted = select_top_scores(scoresPtr, static_cast<int>(num_boxes), score_threshold, -1, sorted_boxes.data());
+        const int io_selection_size = Extensions::Cpu::XARCH::nms_boxes(cornersPtr, cornersPtr + 1, cornersPtr + 2, cornersPtr + 3, 4,
+                                                                        sorted_boxes.data(), num_sorted, max_out_box, conf,
+                                                                        selected_boxes.data());
+
+        int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+        for (int i = 0; i < io_selection_size; i++) {
+            const int box_idx = selected_boxes[i];
+            filtBoxes[offset + i] = filteredBoxes(scoresPtr[box_idx], batch_idx, class_idx, box_idx);
         }
         numFiltBox[batch_idx][class_idx] = io_selection_size;
     });
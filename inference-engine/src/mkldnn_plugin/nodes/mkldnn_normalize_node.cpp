@@ -13,6 +13,7 @@
 #include <mkldnn_extension_utils.h>
 #include "emitters/jit_bf16_emitters.hpp"
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_kernel_cache.hpp"
 #include <cpu/x64/jit_uni_eltwise_injector.hpp>
 #include <cpu/x64/jit_uni_depthwise_injector.hpp>
 #include <cpu/x64/jit_uni_quantization_injector.hpp>
@@ -643,6 +644,36 @@ private:
     }
 };
 
+static MKLDNNKernelKey normalizeKernelKey(const std::string& name, cpu_isa_t isa, const jit_normalize_config_params& jcp) {
+    MKLDNNKernelKey key(name);
+    key << isa << jcp.is_nchw << jcp.is_nhwc << jcp.is_blk << jcp.across_spatial << static_cast<int>(jcp.src_dt)
+        << static_cast<int>(jcp.dst_dt) << jcp.src_data_size << jcp.dst_data_size << jcp.n << jcp.c << jcp.h << jcp.w;
+    return key;
+}
+
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_normalize_modulo_kernel> createNormalizeModuloKernel(const jit_normalize_config_params& jcp) {
+    return MKLDNNKernelCache::get()->getOrCreate<jit_uni_normalize_modulo_kernel>(normalizeKernelKey("normalize_modulo", isa, jcp), [&] {
+        std::shared_ptr<jit_uni_normalize_modulo_kernel> kernel(new jit_uni_normalize_modulo_kernel_f32<isa>(jcp));
+        kernel->create_ker();
+        return kernel;
+    });
+}
+
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_normalize_kernel> createNormalizeKernel(const jit_normalize_config_params& jcp,
+                                                                       const mkldnn_primitive_attr& attr) {
+    auto create = [&] {
+        std::shared_ptr<jit_uni_normalize_kernel> kernel(new jit_uni_normalize_kernel_f32<isa>(jcp, attr));
+        kernel->create_ker();
+        return kernel;
+    };
+    auto key = normalizeKernelKey("normalize", isa, jcp);
+    if (!key.appendPostOps(attr))
+        return create();
+    return MKLDNNKernelCache::get()->getOrCreate<jit_uni_normalize_kernel>(key, create);
+}
+
 MKLDNNNormalizeL2Node::MKLDNNNormalizeL2Node(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
         MKLDNNNode(op, eng, cache), src_data_size(0lu), dst_data_size(0lu), input_prec(Precision::UNSPECIFIED), output_prec(Precision::UNSPECIFIED) {
     std::string errorMessage;
@@ -847,20 +878,15 @@ void MKLDNNNormalizeL2Node::createPrimitive() {
         jcp.w = (dims_size > 3) ? dims[3] : 1lu;
 
         if (mayiuse(cpu::x64::avx512_common)) {
-            normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::x64::avx512_common>(jcp));
-            normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+            normalize_modulo_kernel = createNormalizeModuloKernel<cpu::x64::avx512_common>(jcp);
+            normalize_kernel = createNormalizeKernel<cpu::x64::avx512_common>(jcp, *attr.get());
         } else if (mayiuse(cpu::x64::avx2)) {
-            normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::x64::avx2>(jcp));
-            normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+            normalize_modulo_kernel = createNormalizeModuloKernel<cpu::x64::avx2>(jcp);
+            normalize_kernel = createNormalizeKernel<cpu::x64::avx2>(jcp, *attr.get());
         } else if (mayiuse(cpu::x64::sse41)) {
-            normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::x64::sse41>(jcp));
-            normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
+            normalize_modulo_kernel = createNormalizeModuloKernel<cpu::x64::sse41>(jcp);
+            normalize_kernel = createNormalizeKernel<cpu::x64::sse41>(jcp, *attr.get());
         }
-        if (normalize_kernel)
-            normalize_kernel->create_ker();
-
-        if (normalize_modulo_kernel)
-            normalize_modulo_kernel->create_ker();
 
         const auto &p = (*attr.get()).post_ops_;
         for (int i = 0; i < p.len(); i++) {
@@ -11,6 +11,7 @@
 #include <set>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.hpp"
 #include "utils/bfloat16.hpp"
 #include "emitters/jit_bf16_emitters.hpp"
 #include "ie_parallel.hpp"
@@ -1329,6 +1330,31 @@ private:
     }
 };
 
+static MKLDNNKernelKey reduceKernelKey(const std::string& name, cpu_isa_t isa, const jit_reduce_config_params& jcp) {
+    MKLDNNKernelKey key(name);
+    key << isa << jcp.planar_layout << jcp.reduce_mode << static_cast<int>(jcp.src_dt) << static_cast<int>(jcp.dst_dt)
+        << jcp.src_data_size << jcp.dst_data_size;
+    return key;
+}
+
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_reduce_kernel> createReduceKernel(const jit_reduce_config_params& jcp) {
+    return MKLDNNKernelCache::get()->getOrCreate<jit_uni_reduce_kernel>(reduceKernelKey("reduce", isa, jcp), [&] {
+        std::shared_ptr<jit_uni_reduce_kernel> kernel(new jit_uni_reduce_kernel_f32<isa>(jcp));
+        kernel->create_ker();
+        return kernel;
+    });
+}
+
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_reduce_post_kernel> createReducePostKernel(const jit_reduce_config_params& jcp) {
+    return MKLDNNKernelCache::get()->getOrCreate<jit_uni_reduce_post_kernel>(reduceKernelKey("reduce_post", isa, jcp), [&] {
+        std::shared_ptr<jit_uni_reduce_post_kernel> kernel(new jit_uni_reduce_post_kernel_f32<isa>(jcp));
+        kernel->create_ker();
+        return kernel;
+    });
+}
+
 std::map<const ngraph::DiscreteTypeInfo, std::function<void(const std::shared_ptr<ngraph::Node>&, MKLDNNReduceNode&)>> MKLDNNReduceNode::initializers = {
     {ngraph::opset4::ReduceL1::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNReduceNode& node) {
         node.algorithm = ReduceL1;
@@ -1535,25 +1561,19 @@ void MKLDNNReduceNode::createPrimitive() {
     jcp.reduce_mode = getAlgorithm();
 
     if (mayiuse(cpu::x64::avx512_common)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx512_common>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx512_common>(jcp));
+        reduce_kernel = createReduceKernel<cpu::x64::avx512_common>(jcp);
+        reduce_post_kernel = createReducePostKernel<cpu::x64::avx512_common>(jcp);
         blk_size = 16;
     } else if (mayiuse(cpu::x64::avx2)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx2>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx2>(jcp));
+        reduce_kernel = createReduceKernel<cpu::x64::avx2>(jcp);
+        reduce_post_kernel = createReducePostKernel<cpu::x64::avx2>(jcp);
         blk_size = 8;
     } else if (mayiuse(cpu::x64::sse41)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::sse41>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::sse41>(jcp));
+        reduce_kernel = createReduceKernel<cpu::x64::sse41>(jcp);
+        reduce_post_kernel = createReducePostKernel<cpu::x64::sse41>(jcp);
         blk_size = 8;
     }
 
-    if (reduce_kernel)
-        reduce_kernel->create_ker();
-
-    if (reduce_post_kernel)
-        reduce_post_kernel->create_ker();
-
     jit_mode = jit_mode && reduce_kernel;
 }
 
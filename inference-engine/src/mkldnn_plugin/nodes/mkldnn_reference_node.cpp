@@ -56,20 +56,37 @@ void MKLDNNReferenceNode::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.push_back({config, impl_desc_type::ref, memory::format_tag::undef});
 }
 
-void MKLDNNReferenceNode::createPrimitive() {}
-
-void MKLDNNReferenceNode::execute(mkldnn::stream strm) {
-    ngraph::HostTensorVector inputs;
+void MKLDNNReferenceNode::createPrimitive() {
+    inputMemory.clear();
+    inputs.clear();
     for (size_t i = 0; i < inDims.size(); i++) {
-        void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemory().GetPtr();
-        inputs.push_back(std::make_shared<ngraph::HostTensor>(ngraphOp->get_input_element_type(i), ngraphOp->get_input_shape(i), srcDataPtr));
+        const auto& memory = getParentEdgesAtPort(i)[0]->getMemoryPtr();
+        inputMemory.push_back(memory);
+        inputs.push_back(std::make_shared<ngraph::HostTensor>(ngraphOp->get_input_element_type(i), ngraphOp->get_input_shape(i),
+                                                              memory->GetPtr()));
     }
 
-    ngraph::HostTensorVector outputs;
+    outputMemory.clear();
+    outputs.clear();
     for (size_t i = 0; i < outDims.size(); i++) {
-        void *dstDataPtr = getChildEdgesAtPort(i)[0]->getMemory().GetPtr();
-        outputs.push_back(std::make_shared<ngraph::HostTensor>(ngraphOp->get_output_element_type(i), ngraphOp->get_output_shape(i), dstDataPtr));
+        const auto& memory = getChildEdgesAtPort(i)[0]->getMemoryPtr();
+        outputMemory.push_back(memory);
+        outputs.push_back(std::make_shared<ngraph::HostTensor>(ngraphOp->get_output_element_type(i), ngraphOp->get_output_shape(i),
+                                                               memory->GetPtr()));
     }
+}
+
+void MKLDNNReferenceNode::bindTensor(ngraph::HostTensorPtr& tensor, const MKLDNNMemory& memory) {
+    void* data = memory.GetPtr();
+    if (tensor->get_data_ptr() != data)
+        tensor = std::make_shared<ngraph::HostTensor>(tensor->get_element_type(), tensor->get_shape(), data);
+}
+
+void MKLDNNReferenceNode::execute(mkldnn::stream strm) {
+    for (size_t i = 0; i < inputs.size(); i++)
+        bindTensor(inputs[i], *inputMemory[i]);
+    for (size_t i = 0; i < outputs.size(); i++)
+        bindTensor(outputs[i], *outputMemory[i]);
 
     if (!ngraphOp->evaluate(outputs, inputs)) {
         IE_THROW() << "Evaluation failed on node of type: " << std::string(ngraphOp->get_type_name()) << " name: " << getName();
@@ -6,6 +6,8 @@
 
 //#include <ie_common.h>
 #include <mkldnn_node.h>
+#include <ngraph/runtime/host_tensor.hpp>
+#include <vector>
 //#include <string>
 
 namespace MKLDNNPlugin {
@@ -21,8 +23,18 @@ public:
     bool created() const override;
 
 private:
+    // Points the tensor to the current data of the memory. The pointer is changed only when the memory is switched
+    // to the blobs of the infer request, so the tensors are not recreated on every inference.
+    static void bindTensor(ngraph::HostTensorPtr& tensor, const MKLDNNMemory& memory);
+
     const std::shared_ptr<ngraph::Node> ngraphOp;
     const std::string additionalErrorMessage;
+
+    // the evaluation context prepared by createPrimitive
+    std::vector<MKLDNNMemoryPtr> inputMemory;
+    std::vector<MKLDNNMemoryPtr> outputMemory;
+    ngraph::HostTensorVector inputs;
+    ngraph::HostTensorVector outputs;
 };
 
 }  // namespace MKLDNNPlugin
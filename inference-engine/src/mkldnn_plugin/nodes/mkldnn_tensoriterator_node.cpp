@@ -4,9 +4,11 @@
 
 #include "mkldnn_tensoriterator_node.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <mkldnn_extension_utils.h>
 #include <ie_ngraph_utils.hpp>
 #include <utils/general_utils.h>
@@ -90,15 +92,37 @@ public:
     }
 
     void execute(mkldnn::stream strm, int iter) override {
-        IE_ASSERT(iter >= 0 && iter < iter_count);
-
         auto &chunk_mem = sliced_src ? mem_holder_src : mem_holder_dst;
-        chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                chunk_offset_in_byte + chunk_stride_in_byte * iter);
+        chunk_mem.set_data_handle(getChunkPtr(iter));
 
         reorder.execute(strm, mem_holder_src, mem_holder_dst);
     }
 
+    // the body tensor has the same plain layout as the chunk of the full one, so it may be placed right into the chunk
+    bool isChunkLayout(const MKLDNNMemoryPtr &part) const {
+        const auto &chunk_mem = sliced_src ? mem_holder_src : mem_holder_dst;
+        const auto chunk = chunk_mem.get_desc().data;
+        const auto desc = part->GetDescriptor().data;
+        if (chunk.format_kind != dnnl_blocked || desc.format_kind != dnnl_blocked ||
+                chunk.format_desc.blocking.inner_nblks != 0 || desc.format_desc.blocking.inner_nblks != 0 ||
+                chunk.extra.flags != 0 || desc.extra.flags != 0 ||
+                chunk.ndims != desc.ndims || chunk.data_type != desc.data_type || chunk.offset0 != desc.offset0)
+            return false;
+        // the strides of the unit dimensions don't matter
+        for (int i = 0; i < desc.ndims; i++) {
+            if (chunk.dims[i] != desc.dims[i] || chunk.padded_dims[i] != desc.padded_dims[i] ||
+                    (desc.dims[i] != 1 && chunk.format_desc.blocking.strides[i] != desc.format_desc.blocking.strides[i]))
+                return false;
+        }
+        return true;
+    }
+
+protected:
+    void* getChunkPtr(int iter) const {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+        return static_cast<uint8_t *>(full_mem.get_data_handle()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+    }
+
 private:
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
@@ -109,6 +133,26 @@ private:
     int iter_count;
 };
 
+/**
+ * Places the body tensor right into the chunk of the full tensor instead of copying the chunk.
+ * Applied before the iteration, so the body reads the input chunk or writes the output one directly.
+ */
+class PortChunkInPlaceHelper : public PortIteratorHelper {
+public:
+    PortChunkInPlaceHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src, const PortMap &slice_rule,
+                           const mkldnn::engine& eng, const std::vector<mkldnn::memory> &part_mem)
+                           : PortIteratorHelper(from, to, sliced_src, slice_rule, eng), part_mem(part_mem) {}
+
+    void execute(mkldnn::stream strm, int iter) override {
+        auto chunk_ptr = getChunkPtr(iter);
+        for (auto &mem : part_mem)
+            mem.set_data_handle(chunk_ptr);
+    }
+
+private:
+    std::vector<mkldnn::memory> part_mem;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -124,6 +168,30 @@ public:
     }
 };
 
+/**
+ * Swaps the buffers of the body output and the body input of the back edge instead of copying the data,
+ * so the output of the previous iteration becomes the input of the next one and vice versa.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<mkldnn::memory> &from, const std::vector<mkldnn::memory> &to)
+                       : from_mem(from), to_mem(to) {}
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter != 0) {
+            auto from_ptr = from_mem[0].get_data_handle();
+            auto to_ptr = to_mem[0].get_data_handle();
+            for (auto &mem : from_mem)
+                mem.set_data_handle(to_ptr);
+            for (auto &mem : to_mem)
+                mem.set_data_handle(from_ptr);
+        }
+    }
+
+private:
+    std::vector<mkldnn::memory> from_mem, to_mem;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -188,6 +256,70 @@ private:
     int value;
 };
 
+// Number of bytes from the data handle to the end of the last element, upper bound for the blocked layouts
+static size_t getMemorySpan(const MKLDNNMemory &mem) {
+    const auto &desc = mem.GetDescriptor().data;
+    size_t span = desc.offset0 + 1;
+    for (int i = 0; i < desc.ndims; i++)
+        span += (desc.padded_dims[i] - 1) * desc.format_desc.blocking.strides[i];
+    return std::max(span * MKLDNNExtensionUtils::sizeOfDataType(mem.GetDataType()), mem.GetSize());
+}
+
+/**
+ * Collects the memory of the body edges sharing the buffer of a body port, so the data handle of the port can be replaced.
+ * Returns nothing if any other edge views the buffer (in-place nodes) or the consumers keep the pointers to the data.
+ */
+static std::vector<mkldnn::memory> getReplaceableMemory(MKLDNNGraph &graph, const std::vector<MKLDNNEdgePtr> &edges) {
+    if (edges.empty())
+        return {};
+
+    for (auto &edge : graph.GetEdges()) {
+        if (edge->getMemory().GetDescriptor().data.format_kind != dnnl_blocked)
+            return {};
+    }
+
+    const auto &port_mem = edges[0]->getMemory();
+    const auto begin = static_cast<const uint8_t*>(port_mem.GetData());
+    const auto end = begin + getMemorySpan(port_mem);
+
+    std::vector<mkldnn::memory> result;
+    for (auto &edge : edges) {
+        auto child = edge->getChild();
+        // Split and Concat use the pointers computed on the primitive creation
+        if (child->isConstant() || one_of(child->getType(), Split, Concatenation))
+            return {};
+        if (edge->getMemory().GetData() != port_mem.GetData())
+            return {};
+        result.push_back(edge->getMemory().GetPrimitive());
+    }
+
+    for (auto &edge : graph.GetEdges()) {
+        const auto &mem = edge->getMemory();
+        const auto edge_begin = static_cast<const uint8_t*>(mem.GetData());
+        const auto edge_end = edge_begin + getMemorySpan(mem);
+        if (edge_begin < end && begin < edge_end && std::find(edges.begin(), edges.end(), edge) == edges.end())
+            return {};
+    }
+    return result;
+}
+
+static std::vector<mkldnn::memory> getReplaceableInputMemory(MKLDNNGraph &graph, const MKLDNNNodePtr &input) {
+    std::vector<MKLDNNEdgePtr> edges;
+    for (size_t i = 0; i < input->getChildEdges().size(); i++)
+        edges.push_back(input->getChildEdgeAt(i));
+    return getReplaceableMemory(graph, edges);
+}
+
+static std::vector<mkldnn::memory> getReplaceableOutputMemory(MKLDNNGraph &graph, const MKLDNNNodePtr &output) {
+    auto edge = output->getParentEdgeAt(0);
+    auto producer = edge->getParent();
+    // the invariant producer isn't executed by the next iterations, so it can't follow the new buffer
+    if (producer->getType() == Input || producer->isConstant() || producer->isInplace() || graph.isInvariant(producer) ||
+            one_of(producer->getType(), Split, Concatenation))
+        return {};
+    return getReplaceableMemory(graph, producer->getChildEdgesAtPort(edge->getInputNum()));
+}
+
 }  // namespace MKLDNNPlugin
 
 int getNumIteration(const std::shared_ptr<const ngraph::Node>& op, const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) {
@@ -296,6 +428,14 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         IE_THROW() << "Can't cast TensorIterator node with name: " << getName() << " to ngraph::op::util::SubGraphOp";
     }
     const std::shared_ptr<const ngraph::Function> body = tiOp->get_function();
+
+    // the body nodes depending only on the invariant inputs are executed by the first iteration
+    std::set<std::string> invariantInputs;
+    for (const auto& desc : tiOp->get_input_descriptions()) {
+        if (std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp::InvariantInputDescription>(desc))
+            invariantInputs.insert(body->get_parameters()[desc->m_body_parameter_index]->get_friendly_name());
+    }
+    sub_graph.SetInvariantInputs(invariantInputs);
     sub_graph.CreateGraph(body, ext_mng, weightCache);
 
     const auto &inMap = sub_graph.GetInputNodesMap();
@@ -304,6 +444,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (inNode != inMap.end()) {
             auto inMem = inNode->second->getChildEdgeAt(0)->getMemoryPtr();
             input_mem.push_back(inMem);
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -318,6 +459,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_nodes.push_back(outNode->second);
         }
     }
 
@@ -400,32 +542,46 @@ void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
 void MKLDNNTensorIteratorNode::createPrimitive() {
     const auto &eng = getEngine();
 
+    // body ports whose data handles are replaced by the in-place helpers, each port may be replaced by one helper only
+    std::vector<bool> input_replaced(input_nodes.size(), false), output_replaced(output_nodes.size(), false);
+
     for (auto map_rule : inputPortMap) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
-    }
-
-    for (auto map_rule : outputPortMap) {
-        auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &from_mem = output_mem[map_rule.to];
-
-        if (map_rule.axis == -1)
-            last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
+        } else {
+            std::shared_ptr<PortIteratorHelper> helper(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
+            auto part_mem = helper->isChunkLayout(to_mem) ? getReplaceableInputMemory(sub_graph, input_nodes[map_rule.to])
+                                                          : std::vector<mkldnn::memory>{};
+            if (!part_mem.empty()) {
+                helper.reset(new PortChunkInPlaceHelper(from_mem, to_mem, true, map_rule, eng, part_mem));
+                input_replaced[map_rule.to] = true;
+            }
+            before_mappers.push_back(helper);
+        }
     }
 
+    // the copying back edges read the body outputs before the swapping ones replace them
+    std::vector<std::shared_ptr<PortMapHelper>> swap_mappers;
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        std::vector<mkldnn::memory> swap_from, swap_to;
+        if (!output_replaced[map_rule.from] && !input_replaced[map_rule.to] && from_mem->GetDescriptor() == to_mem->GetDescriptor()) {
+            swap_from = getReplaceableOutputMemory(sub_graph, output_nodes[map_rule.from]);
+            swap_to = getReplaceableInputMemory(sub_graph, input_nodes[map_rule.to]);
+        }
+        if (!swap_from.empty() && !swap_to.empty()) {
+            swap_mappers.emplace_back(new BackEdgeSwapHelper(swap_from, swap_to));
+            output_replaced[map_rule.from] = input_replaced[map_rule.to] = true;
+        } else {
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        }
     }
+    before_mappers.insert(before_mappers.end(), swap_mappers.begin(), swap_mappers.end());
 
     // special purpose ports
     for (auto idx : loopBodyCurrentIterationIdx) {
@@ -433,6 +589,26 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         before_mappers.emplace_back(new IterCountPortHelper(to_mem, eng));
     }
 
+    // the body outputs are pointed to the chunks after the back edges have read the previous iteration results
+    for (auto map_rule : outputPortMap) {
+        auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
+        auto &from_mem = output_mem[map_rule.to];
+
+        if (map_rule.axis == -1) {
+            last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        } else {
+            std::shared_ptr<PortIteratorHelper> helper(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
+            auto part_mem = !output_replaced[map_rule.to] && helper->isChunkLayout(from_mem)
+                            ? getReplaceableOutputMemory(sub_graph, output_nodes[map_rule.to]) : std::vector<mkldnn::memory>{};
+            if (!part_mem.empty()) {
+                before_mappers.emplace_back(new PortChunkInPlaceHelper(from_mem, to_mem, false, map_rule, eng, part_mem));
+                output_replaced[map_rule.to] = true;
+            } else {
+                after_mappers.push_back(helper);
+            }
+        }
+    }
+
     if (loopBodyConditionOutputIdx == -1) {
         continue_cond_check.reset(new staticValueCheck(true)); // always true
     } else {
@@ -0,0 +1,522 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_imp.hpp"
+
+#include <climits>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <ie_common.h>
+#include "ie_parallel.hpp"
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// The elements are compared as int32 keys with the same ordering, so all the precisions share the same code.
+// The keys are inverted for the min mode, so the best element always has the largest key.
+
+inline int32_t float_key(uint32_t bits) {
+    const int32_t key = static_cast<int32_t>(bits ^ (static_cast<uint32_t>(static_cast<int32_t>(bits) >> 31) & 0x7FFFFFFFu));
+    return key == -1 ? 0 : key;  // -0.0 is equal to 0.0
+}
+
+inline int32_t to_key(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return float_key(bits);
+}
+
+// bfloat16
+inline int32_t to_key(uint16_t value) {
+    return float_key(static_cast<uint32_t>(value) << 16);
+}
+
+inline int32_t to_key(int32_t value) {
+    return value;
+}
+
+inline int32_t to_key(int8_t value) {
+    return value;
+}
+
+inline int32_t to_key(uint8_t value) {
+    return value;
+}
+
+#if defined(HAVE_AVX512F)
+constexpr int vec_width = 16;
+using vec = __m512i;
+using vmask = __mmask16;
+
+inline vec vset1(int32_t value) { return _mm512_set1_epi32(value); }
+inline vec vloadu(const int32_t* ptr) { return _mm512_loadu_si512(ptr); }
+inline void vstoreu(int32_t* ptr, vec v) { _mm512_storeu_si512(ptr, v); }
+inline vec vmax(vec a, vec b) { return _mm512_max_epi32(a, b); }
+inline vec vxor(vec a, vec b) { return _mm512_xor_si512(a, b); }
+inline vmask vgt(vec a, vec b) { return _mm512_cmpgt_epi32_mask(a, b); }
+inline vmask veq(vec a, vec b) { return _mm512_cmpeq_epi32_mask(a, b); }
+inline vmask mand(vmask a, vmask b) { return a & b; }
+inline vmask mor(vmask a, vmask b) { return a | b; }
+inline bool many(vmask m) { return m != 0; }
+// mask ? b : a
+inline vec vblend(vec a, vec b, vmask m) { return _mm512_mask_blend_epi32(m, a, b); }
+
+inline vec vfloat_key(vec bits) {
+    const vec key = _mm512_xor_si512(bits, _mm512_and_si512(_mm512_srai_epi32(bits, 31), vset1(0x7FFFFFFF)));
+    return _mm512_maskz_mov_epi32(_mm512_cmpneq_epi32_mask(key, vset1(-1)), key);
+}
+
+inline vec vload_keys(const float* ptr) {
+    return vfloat_key(_mm512_loadu_si512(ptr));
+}
+inline vec vload_keys(const uint16_t* ptr) {
+    return vfloat_key(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));
+}
+inline vec vload_keys(const int32_t* ptr) {
+    return _mm512_loadu_si512(ptr);
+}
+inline vec vload_keys(const int8_t* ptr) {
+    return _mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+}
+inline vec vload_keys(const uint8_t* ptr) {
+    return _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+}
+#elif defined(HAVE_AVX2)
+constexpr int vec_width = 8;
+using vec = __m256i;
+using vmask = __m256i;
+
+inline vec vset1(int32_t value) { return _mm256_set1_epi32(value); }
+inline vec vloadu(const int32_t* ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+inline void vstoreu(int32_t* ptr, vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), v); }
+inline vec vmax(vec a, vec b) { return _mm256_max_epi32(a, b); }
+inline vec vxor(vec a, vec b) { return _mm256_xor_si256(a, b); }
+inline vmask vgt(vec a, vec b) { return _mm256_cmpgt_epi32(a, b); }
+inline vmask veq(vec a, vec b) { return _mm256_cmpeq_epi32(a, b); }
+inline vmask mand(vmask a, vmask b) { return _mm256_and_si256(a, b); }
+inline vmask mor(vmask a, vmask b) { return _mm256_or_si256(a, b); }
+inline bool many(vmask m) { return !_mm256_testz_si256(m, m); }
+// mask ? b : a
+inline vec vblend(vec a, vec b, vmask m) { return _mm256_blendv_epi8(a, b, m); }
+
+inline vec vfloat_key(vec bits) {
+    const vec key = _mm256_xor_si256(bits, _mm256_and_si256(_mm256_srai_epi32(bits, 31), vset1(0x7FFFFFFF)));
+    return _mm256_andnot_si256(_mm256_cmpeq_epi32(key, vset1(-1)), key);
+}
+
+inline vec vload_keys(const float* ptr) {
+    return vfloat_key(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));
+}
+inline vec vload_keys(const uint16_t* ptr) {
+    return vfloat_key(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))), 16));
+}
+inline vec vload_keys(const int32_t* ptr) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+}
+inline vec vload_keys(const int8_t* ptr) {
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)));
+}
+inline vec vload_keys(const uint8_t* ptr) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)));
+}
+#elif defined(HAVE_SSE42)
+constexpr int vec_width = 4;
+using vec = __m128i;
+using vmask = __m128i;
+
+inline vec vset1(int32_t value) { return _mm_set1_epi32(value); }
+inline vec vloadu(const int32_t* ptr) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); }
+inline void vstoreu(int32_t* ptr, vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), v); }
+inline vec vmax(vec a, vec b) { return _mm_max_epi32(a, b); }
+inline vec vxor(vec a, vec b) { return _mm_xor_si128(a, b); }
+inline vmask vgt(vec a, vec b) { return _mm_cmpgt_epi32(a, b); }
+inline vmask veq(vec a, vec b) { return _mm_cmpeq_epi32(a, b); }
+inline vmask mand(vmask a, vmask b) { return _mm_and_si128(a, b); }
+inline vmask mor(vmask a, vmask b) { return _mm_or_si128(a, b); }
+inline bool many(vmask m) { return !_mm_testz_si128(m, m); }
+// mask ? b : a
+inline vec vblend(vec a, vec b, vmask m) { return _mm_blendv_epi8(a, b, m); }
+
+inline vec vfloat_key(vec bits) {
+    const vec key = _mm_xor_si128(bits, _mm_and_si128(_mm_srai_epi32(bits, 31), vset1(0x7FFFFFFF)));
+    return _mm_andnot_si128(_mm_cmpeq_epi32(key, vset1(-1)), key);
+}
+
+inline int32_t load_4_bytes(const void* ptr) {
+    int32_t bytes;
+    std::memcpy(&bytes, ptr, sizeof(bytes));
+    return bytes;
+}
+
+inline vec vload_keys(const float* ptr) {
+    return vfloat_key(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+}
+inline vec vload_keys(const uint16_t* ptr) {
+    return vfloat_key(_mm_slli_epi32(_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr))), 16));
+}
+inline vec vload_keys(const int32_t* ptr) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+}
+inline vec vload_keys(const int8_t* ptr) {
+    return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(load_4_bytes(ptr)));
+}
+inline vec vload_keys(const uint8_t* ptr) {
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(load_4_bytes(ptr)));
+}
+#else
+constexpr int vec_width = 1;
+#endif
+
+// insertion is used for top_k up to this size, the sorting networks are used for up to this number of elements
+constexpr int max_small_k = 32;
+// the heap is used while top_k is this many times less than the axis, the radix selection is used otherwise
+constexpr int min_heap_ratio = 64;
+
+template <typename T>
+void load_row(const T* src, int stride, int num, int32_t inv, int32_t* keys) {
+    int i = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (stride == 1) {
+        const vec vinv = vset1(inv);
+        for (; i <= num - vec_width; i += vec_width)
+            vstoreu(keys + i, vxor(vload_keys(src + i), vinv));
+    }
+#endif
+    for (; i < num; i++)
+        keys[i] = to_key(src[static_cast<size_t>(i) * stride]) ^ inv;
+}
+
+// the first position from i which may have the key greater than the worst one, or the end of the vector block
+inline int skip_worse(const int32_t* keys, int i, int num, int32_t worst) {
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec vworst = vset1(worst);
+    while (i <= num - vec_width && !many(vgt(vloadu(keys + i), vworst)))
+        i += vec_width;
+#endif
+    return i;
+}
+
+// positions of top_k largest keys in the descending order of the keys, the lower position goes first for the equal keys
+void select_by_insertion(const int32_t* keys, int num, int top_k, int32_t* best_keys, int* best) {
+    int count = 0;
+    auto insert = [&](int i) {
+        int pos = count < top_k ? count++ : top_k - 1;
+        for (; pos > 0 && keys[i] > best_keys[pos - 1]; pos--) {
+            best_keys[pos] = best_keys[pos - 1];
+            best[pos] = best[pos - 1];
+        }
+        best_keys[pos] = keys[i];
+        best[pos] = i;
+    };
+
+    int i = 0;
+    for (; i < top_k; i++)
+        insert(i);
+
+    // the worst selected element has the lower position, so the following ones should have the greater key
+    while (i < num) {
+        i = skip_worse(keys, i, num, best_keys[top_k - 1]);
+        for (const int end = std::min(i + vec_width, num); i < end; i++) {
+            if (keys[i] > best_keys[top_k - 1])
+                insert(i);
+        }
+    }
+}
+
+// positions of top_k largest keys in an arbitrary order, the lower position is selected for the equal keys
+void select_by_heap(const int32_t* keys, int num, int top_k, int* best) {
+    // the worst selected position is on the top of the heap
+    auto better = [keys](int i, int j) {
+        return keys[i] > keys[j] || (keys[i] == keys[j] && i < j);
+    };
+
+    int i = 0;
+    for (; i < top_k; i++)
+        best[i] = i;
+    std::make_heap(best, best + top_k, better);
+
+    while (i < num) {
+        i = skip_worse(keys, i, num, keys[best[0]]);
+        for (const int end = std::min(i + vec_width, num); i < end; i++) {
+            if (keys[i] > keys[best[0]]) {
+                std::pop_heap(best, best + top_k, better);
+                best[top_k - 1] = i;
+                std::push_heap(best, best + top_k, better);
+            }
+        }
+    }
+}
+
+// positions of top_k largest keys in the ascending order, the lower position is selected for the equal keys
+void select_by_radix(const int32_t* keys, int num, int top_k, int* best) {
+    // find the key prefix of the k-th largest element one byte at a time
+    uint32_t prefix = 0, mask = 0;
+    int needed = top_k;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        int histogram[256] = {};
+        for (int i = 0; i < num; i++) {
+            const uint32_t key = static_cast<uint32_t>(keys[i]) ^ 0x80000000u;
+            if ((key & mask) == prefix)
+                histogram[(key >> shift) & 0xFF]++;
+        }
+
+        int digit = 255;
+        for (; histogram[digit] < needed; digit--)
+            needed -= histogram[digit];
+
+        prefix |= static_cast<uint32_t>(digit) << shift;
+        mask |= 0xFFu << shift;
+        // all the elements with this prefix are selected, there is no need to look at the lower bytes
+        if (histogram[digit] == needed)
+            break;
+    }
+
+    int selected = 0;
+    for (int i = 0; i < num; i++) {
+        const uint32_t key = (static_cast<uint32_t>(keys[i]) ^ 0x80000000u) & mask;
+        if (key > prefix || (key == prefix && needed-- > 0))
+            best[selected++] = i;
+    }
+}
+
+// handles the slices from the column first_col one by one
+template <typename T>
+void topk_rows(const T* src, T* dst_values, int* dst_indices, const topk_conf& conf, int first_col) {
+    const int num = conf.axis_dim;
+    const int top_k = conf.top_k;
+    const int stride = conf.after_num;
+    const int cols = stride - first_col;
+    const size_t rows = static_cast<size_t>(conf.before_num) * cols;
+    const int32_t inv = conf.mode_max ? 0 : -1;
+    const bool small_k = top_k <= max_small_k;
+    if (rows == 0)
+        return;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(rows, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<int32_t> keys(num);
+        std::vector<int32_t> best_keys(small_k ? top_k : 0);
+        std::vector<int> best(top_k);
+        for (size_t row = start; row < end; row++) {
+            const size_t b = row / cols;
+            const size_t col = first_col + row % cols;
+            const T* src_row = src + b * num * stride + col;
+
+            load_row(src_row, stride, num, inv, keys.data());
+            if (small_k) {
+                select_by_insertion(keys.data(), num, top_k, best_keys.data(), best.data());
+                if (conf.sort_index)
+                    std::sort(best.begin(), best.end());
+            } else {
+                if (top_k == num) {
+                    for (int i = 0; i < num; i++)
+                        best[i] = i;
+                } else if (top_k <= num / min_heap_ratio) {
+                    select_by_heap(keys.data(), num, top_k, best.data());
+                    if (conf.sort_index)
+                        std::sort(best.begin(), best.end());
+                } else {
+                    select_by_radix(keys.data(), num, top_k, best.data());
+                }
+                if (!conf.sort_index) {
+                    std::sort(best.begin(), best.end(), [&keys](int i, int j) {
+                        return keys[i] > keys[j] || (keys[i] == keys[j] && i < j);
+                    });
+                }
+            }
+
+            const size_t dst_offset = b * top_k * stride + col;
+            for (int j = 0; j < top_k; j++) {
+                const size_t dst_pos = dst_offset + static_cast<size_t>(j) * stride;
+                if (dst_values)
+                    dst_values[dst_pos] = src_row[static_cast<size_t>(best[j]) * stride];
+                if (dst_indices)
+                    dst_indices[dst_pos] = best[j];
+            }
+        }
+    });
+}
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+// lanes where the element a is better than the element b
+inline vmask better(vec key_a, vec idx_a, vec key_b, vec idx_b) {
+    return mor(vgt(key_a, key_b), mand(veq(key_a, key_b), vgt(idx_b, idx_a)));
+}
+
+// moves the better element to the position i
+template <bool by_index>
+inline void compare_exchange(vec* keys, vec* idx, int i, int j) {
+    const vmask swap = by_index ? vgt(idx[i], idx[j]) : better(keys[j], idx[j], keys[i], idx[i]);
+    const vec key_i = keys[i];
+    const vec idx_i = idx[i];
+    keys[i] = vblend(key_i, keys[j], swap);
+    keys[j] = vblend(keys[j], key_i, swap);
+    idx[i] = vblend(idx_i, idx[j], swap);
+    idx[j] = vblend(idx[j], idx_i, swap);
+}
+
+// bitonic sorting network for the power of two size, the best element goes first
+template <bool by_index>
+void bitonic_sort(vec* keys, vec* idx, int size) {
+    for (int block = 2; block <= size; block *= 2) {
+        for (int dist = block / 2; dist > 0; dist /= 2) {
+            for (int i = 0; i < size; i++) {
+                const int j = i ^ dist;
+                if (j < i)
+                    continue;
+                if (i & block)
+                    compare_exchange<by_index>(keys, idx, j, i);
+                else
+                    compare_exchange<by_index>(keys, idx, i, j);
+            }
+        }
+    }
+}
+
+// sorts the bitonic sequence
+void bitonic_merge(vec* keys, vec* idx, int size) {
+    for (int dist = size / 2; dist > 0; dist /= 2) {
+        for (int i = 0; i < size; i++) {
+            if (!(i & dist))
+                compare_exchange<false>(keys, idx, i, i + dist);
+        }
+    }
+}
+
+// handles vec_width adjacent slices at once, every vector lane keeps the best elements of its own slice
+template <typename T>
+void topk_lanes(const T* src, T* dst_values, int* dst_indices, const topk_conf& conf) {
+    const int num = conf.axis_dim;
+    const int top_k = conf.top_k;
+    const int stride = conf.after_num;
+    int size = 1;
+    while (size < top_k)
+        size *= 2;
+
+    const vec vinv = vset1(conf.mode_max ? 0 : -1);
+    const vec vpad_key = vset1(INT_MIN);
+    const vec vpad_idx = vset1(INT_MAX);
+
+    parallel_for2d(conf.before_num, stride / vec_width, [&](int b, int lanes_block) {
+        const size_t col = static_cast<size_t>(lanes_block) * vec_width;
+        const T* src_lanes = src + static_cast<size_t>(b) * num * stride + col;
+
+        auto load = [&](vec* keys, vec* idx, int first) {
+            for (int i = 0; i < size; i++) {
+                if (first + i < num) {
+                    keys[i] = vxor(vload_keys(src_lanes + static_cast<size_t>(first + i) * stride), vinv);
+                    idx[i] = vset1(first + i);
+                } else {
+                    keys[i] = vpad_key;
+                    idx[i] = vpad_idx;
+                }
+            }
+        };
+
+        vec keys[max_small_k], idx[max_small_k];
+        load(keys, idx, 0);
+        bitonic_sort<false>(keys, idx, size);
+
+        vec block_keys[max_small_k], block_idx[max_small_k];
+        for (int first = size; first < num; first += size) {
+            load(block_keys, block_idx, first);
+
+            // the block elements are after the selected ones, so they should be strictly greater than the k-th one
+            vec block_max = block_keys[0];
+            for (int i = 1; i < size; i++)
+                block_max = vmax(block_max, block_keys[i]);
+            if (!many(vgt(block_max, keys[top_k - 1])))
+                continue;
+
+            // the best half of the sorted sequence and the reversed sorted block is a bitonic sequence
+            bitonic_sort<false>(block_keys, block_idx, size);
+            for (int i = 0; i < size; i++) {
+                const int j = size - 1 - i;
+                const vmask replace = better(block_keys[j], block_idx[j], keys[i], idx[i]);
+                keys[i] = vblend(keys[i], block_keys[j], replace);
+                idx[i] = vblend(idx[i], block_idx[j], replace);
+            }
+            bitonic_merge(keys, idx, size);
+        }
+
+        if (conf.sort_index) {
+            for (int i = top_k; i < size; i++)
+                idx[i] = vpad_idx;
+            bitonic_sort<true>(keys, idx, size);
+        }
+
+        int32_t lanes[vec_width];
+        const size_t dst_offset = static_cast<size_t>(b) * top_k * stride + col;
+        for (int j = 0; j < top_k; j++) {
+            vstoreu(lanes, idx[j]);
+            const size_t dst_pos = dst_offset + static_cast<size_t>(j) * stride;
+            for (int l = 0; l < vec_width; l++) {
+                if (dst_values)
+                    dst_values[dst_pos + l] = src_lanes[static_cast<size_t>(lanes[l]) * stride + l];
+                if (dst_indices)
+                    dst_indices[dst_pos + l] = lanes[l];
+            }
+        }
+    });
+}
+#endif
+
+template <typename T>
+void topk_impl(const uint8_t* src, uint8_t* dst_values, int* dst_indices, const topk_conf& conf) {
+    const T* src_data = reinterpret_cast<const T*>(src);
+    T* dst_data = reinterpret_cast<T*>(dst_values);
+
+    int first_col = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (conf.top_k <= max_small_k && conf.after_num >= vec_width) {
+        topk_lanes(src_data, dst_data, dst_indices, conf);
+        first_col = conf.after_num - conf.after_num % vec_width;
+    }
+#endif
+    topk_rows(src_data, dst_data, dst_indices, conf, first_col);
+}
+
+}  // namespace
+
+void topk_exec(const uint8_t* src, uint8_t* dst_values, int* dst_indices, const topk_conf& conf) {
+    if (conf.top_k <= 0)
+        return;
+
+    switch (conf.precision) {
+        case Precision::FP32:
+            topk_impl<float>(src, dst_values, dst_indices, conf);
+            break;
+        case Precision::BF16:
+            topk_impl<uint16_t>(src, dst_values, dst_indices, conf);
+            break;
+        case Precision::I32:
+            topk_impl<int32_t>(src, dst_values, dst_indices, conf);
+            break;
+        case Precision::I8:
+            topk_impl<int8_t>(src, dst_values, dst_indices, conf);
+            break;
+        case Precision::U8:
+            topk_impl<uint8_t>(src, dst_values, dst_indices, conf);
+            break;
+        default:
+            IE_THROW() << "TopK doesn't support precision " << Precision(conf.precision).name();
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
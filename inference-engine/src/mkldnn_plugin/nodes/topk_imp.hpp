@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <ie_precision.hpp>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct topk_conf {
+    // precision of the data and the output values: FP32, BF16, I32, I8 or U8
+    Precision::ePrecision precision;
+    // the data is [before_num, axis_dim, after_num], the outputs are [before_num, top_k, after_num]
+    int before_num;
+    int axis_dim;
+    int after_num;
+    int top_k;
+    bool mode_max;
+    // sort the selected elements by the index instead of the value
+    bool sort_index;
+};
+
+namespace XARCH {
+
+/**
+ * @brief Selects top_k largest (mode_max) or smallest elements along the axis, the lower index goes first
+ * for the equal values. Small top_k for several adjacent slices at once is handled with SIMD bitonic sorting networks
+ * (one slice per vector lane), the other slices are handled one by one with a SIMD filter of the elements
+ * which are worse than the current k-th one and the insertion (small top_k) or the heap (top_k is much less than
+ * the axis), or with the radix selection.
+ * @param src
+ * input data
+ * @param dst_values
+ * output values, may be nullptr
+ * @param dst_indices
+ * output indices, may be nullptr
+ * @param conf
+ * shapes and parameters
+ */
+
+void topk_exec(const uint8_t* src, uint8_t* dst_values, int* dst_indices, const topk_conf& conf);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
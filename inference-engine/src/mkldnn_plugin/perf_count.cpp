@@ -0,0 +1,179 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+using namespace MKLDNNPlugin;
+
+constexpr int PerfHistogram::subBucketMagnitude;
+constexpr uint64_t PerfHistogram::subBucketCount;
+constexpr int PerfHistogram::maxExponent;
+
+PerfHistogram::PerfHistogram() : counts(subBucketCount * (maxExponent - subBucketMagnitude + 1), 0) {}
+
+void PerfHistogram::merge(const PerfHistogram& other) {
+    for (size_t i = 0; i < counts.size(); i++)
+        counts[i] += other.counts[i];
+    num += other.num;
+    total += other.total;
+    minimum = std::min(minimum, other.minimum);
+    maximum = std::max(maximum, other.maximum);
+}
+
+uint64_t PerfHistogram::highestEquivalentValue(size_t index) {
+    if (index < subBucketCount)
+        return index;
+    const size_t shift = index / subBucketCount - 1;
+    const uint64_t subBucket = index % subBucketCount + subBucketCount;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+uint64_t PerfHistogram::percentile(double percent) const {
+    if (num == 0)
+        return 0;
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percent / 100.0 * num)));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        accumulated += counts[i];
+        if (accumulated >= rank)
+            return std::max(min(), std::min(maximum, highestEquivalentValue(i)));
+    }
+    return maximum;
+}
+
+void PerfDetails::record(uint64_t ns) {
+    histogram.record(ns);
+
+    const auto id = std::this_thread::get_id();
+    auto thread = std::find_if(threads.begin(), threads.end(), [&](const PerfThreadCount& count) { return count.thread == id; });
+    if (thread == threads.end()) {
+        threads.emplace_back();
+        thread = std::prev(threads.end());
+        thread->thread = id;
+    }
+    thread->num++;
+    thread->total += ns;
+    thread->maximum = std::max(thread->maximum, ns);
+}
+
+void PerfDetails::merge(const PerfDetails& other) {
+    histogram.merge(other.histogram);
+    for (const auto& count : other.threads) {
+        auto thread = std::find_if(threads.begin(), threads.end(), [&](const PerfThreadCount& c) { return c.thread == count.thread; });
+        if (thread == threads.end()) {
+            threads.push_back(count);
+        } else {
+            thread->num += count.num;
+            thread->total += count.total;
+            thread->maximum = std::max(thread->maximum, count.maximum);
+        }
+    }
+}
+
+namespace {
+
+// the times are reported in microseconds with the nanosecond resolution
+std::string toMicroseconds(uint64_t ns) {
+    std::ostringstream stream;
+    stream << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+    return stream.str();
+}
+
+std::string toString(std::thread::id id) {
+    std::ostringstream stream;
+    stream << id;
+    return stream.str();
+}
+
+std::string escapeJson(const std::string& value) {
+    std::ostringstream stream;
+    for (char c : value) {
+        switch (c) {
+            case '"': stream << "\\\""; break;
+            case '\\': stream << "\\\\"; break;
+            case '\n': stream << "\\n"; break;
+            case '\t': stream << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                } else {
+                    stream << c;
+                }
+        }
+    }
+    return stream.str();
+}
+
+std::string escapeCsv(const std::string& value) {
+    if (value.find_first_of(";\"\n") == std::string::npos)
+        return value;
+    std::string escaped = "\"";
+    for (char c : value) {
+        if (c == '"')
+            escaped += '"';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+}  // namespace
+
+std::string MKLDNNPlugin::PerfReportToJson(const PerfReport& report) {
+    std::ostringstream json;
+    json << "{\n  \"units\": \"us\",\n  \"nodes\": [";
+    bool firstNode = true;
+    for (const auto& node : report) {
+        const auto& histogram = node.second.details.histogram;
+        json << (firstNode ? "\n" : ",\n");
+        firstNode = false;
+        json << "    {\"name\": \"" << escapeJson(node.first) << "\", "
+             << "\"layerType\": \"" << escapeJson(node.second.layerType) << "\", "
+             << "\"execType\": \"" << escapeJson(node.second.execType) << "\", "
+             << "\"count\": " << histogram.count() << ", "
+             << "\"min\": " << toMicroseconds(histogram.min()) << ", "
+             << "\"avg\": " << toMicroseconds(histogram.avg()) << ", "
+             << "\"p50\": " << toMicroseconds(histogram.percentile(50)) << ", "
+             << "\"p90\": " << toMicroseconds(histogram.percentile(90)) << ", "
+             << "\"p99\": " << toMicroseconds(histogram.percentile(99)) << ", "
+             << "\"max\": " << toMicroseconds(histogram.max()) << ", "
+             << "\"threads\": [";
+        bool firstThread = true;
+        for (const auto& thread : node.second.details.threads) {
+            json << (firstThread ? "" : ", ");
+            firstThread = false;
+            json << "{\"thread\": \"" << toString(thread.thread) << "\", "
+                 << "\"count\": " << thread.num << ", "
+                 << "\"avg\": " << toMicroseconds(thread.num ? thread.total / thread.num : 0) << ", "
+                 << "\"max\": " << toMicroseconds(thread.maximum) << "}";
+        }
+        json << "]}";
+    }
+    json << "\n  ]\n}\n";
+    return json.str();
+}
+
+// the rows of the threads follow the row of their node and have no percentiles
+std::string MKLDNNPlugin::PerfReportToCsv(const PerfReport& report) {
+    std::ostringstream csv;
+    csv << "layerName;layerType;execType;thread;count;min (us);avg (us);p50 (us);p90 (us);p99 (us);max (us)\n";
+    for (const auto& node : report) {
+        const auto& histogram = node.second.details.histogram;
+        const std::string prefix = escapeCsv(node.first) + ";" + escapeCsv(node.second.layerType) + ";" + escapeCsv(node.second.execType) + ";";
+        csv << prefix << "all;" << histogram.count() << ";"
+            << toMicroseconds(histogram.min()) << ";" << toMicroseconds(histogram.avg()) << ";"
+            << toMicroseconds(histogram.percentile(50)) << ";" << toMicroseconds(histogram.percentile(90)) << ";"
+            << toMicroseconds(histogram.percentile(99)) << ";" << toMicroseconds(histogram.max()) << "\n";
+        for (const auto& thread : node.second.details.threads) {
+            csv << prefix << toString(thread.thread) << ";" << thread.num << ";;"
+                << toMicroseconds(thread.num ? thread.total / thread.num : 0) << ";;;;"
+                << toMicroseconds(thread.maximum) << "\n";
+        }
+    }
+    return csv.str();
+}
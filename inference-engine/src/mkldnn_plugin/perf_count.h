@@ -5,31 +5,123 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+/**
+ * Histogram of the execution times in nanoseconds. The values below 16 ns are counted exactly, each next power of two
+ * range is divided into 16 linear sub-buckets, so the percentiles are reported with the relative error below 1/16
+ * using a fixed amount of memory
+ */
+class PerfHistogram {
+public:
+    PerfHistogram();
+
+    void record(uint64_t ns) {
+        counts[index(ns)]++;
+        num++;
+        total += ns;
+        if (ns < minimum) minimum = ns;
+        if (ns > maximum) maximum = ns;
+    }
+
+    void merge(const PerfHistogram& other);
+
+    uint64_t count() const { return num; }
+    uint64_t min() const { return num ? minimum : 0; }
+    uint64_t max() const { return maximum; }
+    uint64_t avg() const { return num ? total / num : 0; }
+
+    // time in nanoseconds, which is not exceeded by the given percent of the executions
+    uint64_t percentile(double percent) const;
+
+private:
+    static constexpr int subBucketMagnitude = 4;
+    static constexpr uint64_t subBucketCount = uint64_t(1) << subBucketMagnitude;
+    // the times above 2^48 ns (~3 days) are saturated
+    static constexpr int maxExponent = 48;
+
+    static size_t index(uint64_t ns) {
+        if (ns < subBucketCount)
+            return static_cast<size_t>(ns);
+        if (ns >> maxExponent)
+            ns = (uint64_t(1) << maxExponent) - 1;
+        int exponent = subBucketMagnitude;
+        while (ns >> (exponent + 1))
+            exponent++;
+        const int shift = exponent - subBucketMagnitude;
+        return static_cast<size_t>(subBucketCount * (shift + 1) + ((ns >> shift) - subBucketCount));
+    }
+
+    static uint64_t highestEquivalentValue(size_t index);
+
+    std::vector<uint32_t> counts;
+    uint64_t num = 0;
+    uint64_t total = 0;
+    uint64_t minimum = std::numeric_limits<uint64_t>::max();
+    uint64_t maximum = 0;
+};
+
+/**
+ * Execution times of the node per thread which executes it, the dataflow mode executes the nodes on the different threads
+ */
+struct PerfThreadCount {
+    std::thread::id thread;
+    uint64_t num = 0;
+    uint64_t total = 0;
+    uint64_t maximum = 0;
+};
+
+struct PerfDetails {
+    PerfHistogram histogram;
+    std::vector<PerfThreadCount> threads;
+
+    void record(uint64_t ns);
+    void merge(const PerfDetails& other);
+};
+
 class PerfCount {
     uint64_t duration;
     uint32_t num;
+    std::unique_ptr<PerfDetails> details;
 
-    std::chrono::high_resolution_clock::time_point __start = {};
-    std::chrono::high_resolution_clock::time_point __finish = {};
+    std::chrono::steady_clock::time_point __start = {};
+    std::chrono::steady_clock::time_point __finish = {};
 
 public:
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    // microseconds
+    uint64_t avg() { return (num == 0) ? 0 : duration / num / 1000; }
+
+    // the histogram and the per thread times are collected since the call
+    void enableDetails() {
+        if (!details)
+            details.reset(new PerfDetails());
+    }
+
+    const PerfDetails* getDetails() const { return details.get(); }
 
 private:
     void start_itr() {
-        __start = std::chrono::high_resolution_clock::now();
+        __start = std::chrono::steady_clock::now();
     }
 
     void finish_itr() {
-        __finish = std::chrono::high_resolution_clock::now();
+        __finish = std::chrono::steady_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        const uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
+        duration += ns;
         num++;
+        if (details)
+            details->record(ns);
     }
 
     friend class PerfHelper;
@@ -44,6 +136,20 @@ public:
     ~PerfHelper() { counter.finish_itr(); }
 };
 
+/**
+ * The details of the node merged over the graphs of all the streams
+ */
+struct PerfNodeReport {
+    std::string layerType;
+    std::string execType;
+    PerfDetails details;
+};
+
+typedef std::map<std::string, PerfNodeReport> PerfReport;
+
+std::string PerfReportToJson(const PerfReport& report);
+std::string PerfReportToCsv(const PerfReport& report);
+
 }  // namespace MKLDNNPlugin
 
 #define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
@@ -0,0 +1,234 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "serialize.h"
+
+#include <sstream>
+#include <vector>
+#include <cstdint>
+#include <iterator>
+
+#include <pugixml.hpp>
+#include <xml_parse_utils.h>
+#include <blob_factory.hpp>
+
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <transformations/serialize.hpp>
+
+using namespace InferenceEngine;
+using namespace XMLParseUtils;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+void writeSection(std::ostream& ostream, const char* data, std::uint64_t dataSize) {
+    ostream.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+    if (dataSize)
+        ostream.write(data, dataSize);
+}
+
+// the stream may end at any place of a damaged cache entry, so every read is checked
+void readData(std::istream& istream, char* data, std::uint64_t dataSize, const char* what) {
+    if (!dataSize)
+        return;
+    istream.read(data, static_cast<std::streamsize>(dataSize));
+    if (istream.fail() || static_cast<std::uint64_t>(istream.gcount()) != dataSize)
+        IE_THROW(NetworkNotRead) << "CPU plugin IR cache is truncated: can't read " << what;
+}
+
+std::uint64_t readSectionSize(std::istream& istream, const char* what) {
+    std::uint64_t dataSize = 0;
+    readData(istream, reinterpret_cast<char*>(&dataSize), sizeof(dataSize), what);
+    return dataSize;
+}
+
+}  // namespace
+
+bool isSerializableFunction(const std::shared_ptr<const ngraph::Function>& function) {
+    static const std::vector<std::reference_wrapper<const ngraph::OpSet>> opsets = {
+        ngraph::get_opset1(), ngraph::get_opset2(), ngraph::get_opset3(), ngraph::get_opset4(),
+        ngraph::get_opset5(), ngraph::get_opset6(), ngraph::get_opset7()};
+
+    for (const auto& op : function->get_ops()) {
+        bool isStandardOp = false;
+        for (const auto& opset : opsets) {
+            if (opset.get().contains_op_type(op.get())) {
+                isStandardOp = true;
+                break;
+            }
+        }
+        if (!isStandardOp)
+            return false;
+
+        if (auto subGraphOp = std::dynamic_pointer_cast<const ngraph::op::util::SubGraphOp>(op)) {
+            if (!isSerializableFunction(subGraphOp->get_function()))
+                return false;
+        }
+    }
+    return true;
+}
+
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream& ostream, bool isTransformed)
+    : _ostream(ostream)
+    , _isTransformed(isTransformed) {
+}
+
+void CNNNetworkSerializer::operator << (const CNNNetwork& network) {
+    IE_ASSERT(network.getFunction() != nullptr);
+
+    // 1. Inputs / outputs info which is not a part of IR
+    pugi::xml_document doc;
+    auto cnndataNode = doc.append_child("cnndata");
+    cnndataNode.append_attribute("transformed").set_value(_isTransformed);
+
+    std::vector<Blob::Ptr> meanImages;
+    auto inputsNode = cnndataNode.append_child("inputs");
+    for (const auto& input : network.getInputsInfo()) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(input.first.c_str());
+        inputNode.append_attribute("precision").set_value(input.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(input.second->getLayout()));
+
+        const PreProcessInfo& preProcess = input.second->getPreProcess();
+        auto preProcessNode = inputNode.append_child("pre-process");
+        preProcessNode.append_attribute("resize-algorithm").set_value(static_cast<int>(preProcess.getResizeAlgorithm()));
+        preProcessNode.append_attribute("color-format").set_value(static_cast<int>(preProcess.getColorFormat()));
+        preProcessNode.append_attribute("mean-variant").set_value(static_cast<int>(preProcess.getMeanVariant()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); ++c) {
+            const PreProcessChannel::Ptr& channelInfo = preProcess[c];
+            auto channelNode = preProcessNode.append_child("channel");
+            channelNode.append_attribute("mean-value").set_value(channelInfo->meanValue);
+            channelNode.append_attribute("std-scale").set_value(channelInfo->stdScale);
+            if (preProcess.getMeanVariant() == MeanVariant::MEAN_IMAGE && channelInfo->meanData) {
+                const auto& desc = channelInfo->meanData->getTensorDesc();
+                auto meanNode = channelNode.append_child("mean-image");
+                meanNode.append_attribute("precision").set_value(desc.getPrecision().name());
+                meanNode.append_attribute("height").set_value(static_cast<unsigned long long>(desc.getDims()[0]));
+                meanNode.append_attribute("width").set_value(static_cast<unsigned long long>(desc.getDims()[1]));
+                meanImages.push_back(channelInfo->meanData);
+            }
+        }
+    }
+
+    auto outputsNode = cnndataNode.append_child("outputs");
+    for (const auto& output : network.getOutputsInfo()) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(output.first.c_str());
+        outputNode.append_attribute("precision").set_value(output.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(output.second->getLayout()));
+    }
+
+    doc.save(_ostream, nullptr, pugi::format_raw);
+    doc.reset();
+    _ostream << std::endl;
+
+    // 2. IR xml and weights
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile, ngraph::pass::Serialize::Version::IR_V10);
+    serializer.run_on_function(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+
+    const auto model = xmlFile.str();
+    const auto constants = binFile.str();
+    writeSection(_ostream, model.c_str(), model.size());
+    writeSection(_ostream, constants.c_str(), constants.size());
+
+    // 3. Mean images data in the same order as they are listed in the header
+    for (const auto& meanImage : meanImages) {
+        writeSection(_ostream, meanImage->cbuffer().as<const char*>(), meanImage->byteSize());
+    }
+}
+
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream& istream, cnn_network_builder fn)
+    : _istream(istream)
+    , _cnn_network_builder(fn) {
+}
+
+void CNNNetworkDeserializer::operator >> (CNNNetwork& network) {
+    std::string xmlInOutString;
+    std::getline(_istream, xmlInOutString);
+    if (_istream.fail() || _istream.eof()) {
+        IE_THROW(NetworkNotRead) << "CPU plugin IR cache is truncated: can't read the header";
+    }
+
+    pugi::xml_document xmlInOutDoc;
+    auto res = xmlInOutDoc.load_string(xmlInOutString.c_str());
+    if (res.status != pugi::status_ok) {
+        IE_THROW(NetworkNotRead) << "Error reading CPU plugin IR cache header";
+    }
+    pugi::xml_node cnndataNode = xmlInOutDoc.document_element();
+    _isTransformed = GetBoolAttr(cnndataNode, "transformed");
+
+    // read XML content
+    std::string xmlString;
+    xmlString.resize(readSectionSize(_istream, "the model size"));
+    readData(_istream, &xmlString[0], xmlString.size(), "the model");
+
+    // read blob content
+    Blob::Ptr dataBlob;
+    if (auto dataSize = readSectionSize(_istream, "the weights size")) {
+        dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {static_cast<size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        readData(_istream, dataBlob->buffer(), dataSize, "the weights");
+    }
+
+    network = _cnn_network_builder(xmlString, std::move(dataBlob));
+
+    // restore inputs and outputs info
+    auto inputs = network.getInputsInfo();
+    FOREACH_CHILD(inputNode, cnndataNode.child("inputs"), "input") {
+        auto name = GetStrAttr(inputNode, "name");
+        auto found = inputs.find(name);
+        if (found == inputs.end()) {
+            IE_THROW(NetworkNotRead) << "CPU plugin IR cache has no input with name " << name;
+        }
+        InputInfo::Ptr info = found->second;
+        info->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        info->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+
+        auto preProcessNode = inputNode.child("pre-process");
+        PreProcessInfo& preProcess = info->getPreProcess();
+        preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(GetIntAttr(preProcessNode, "resize-algorithm")));
+        preProcess.setColorFormat(static_cast<ColorFormat>(GetIntAttr(preProcessNode, "color-format")));
+
+        auto channelNodes = preProcessNode.children("channel");
+        preProcess.init(std::distance(channelNodes.begin(), channelNodes.end()));
+
+        size_t c = 0;
+        FOREACH_CHILD(channelNode, preProcessNode, "channel") {
+            preProcess[c]->meanValue = GetFloatAttr(channelNode, "mean-value");
+            preProcess[c]->stdScale = GetFloatAttr(channelNode, "std-scale");
+            auto meanNode = channelNode.child("mean-image");
+            if (!meanNode.empty()) {
+                TensorDesc desc(Precision::FromStr(GetStrAttr(meanNode, "precision")),
+                                {static_cast<size_t>(GetUInt64Attr(meanNode, "height")),
+                                 static_cast<size_t>(GetUInt64Attr(meanNode, "width"))},
+                                Layout::HW);
+                auto meanImage = make_blob_with_precision(desc);
+                meanImage->allocate();
+                if (readSectionSize(_istream, "the mean image size") != meanImage->byteSize()) {
+                    IE_THROW(NetworkNotRead) << "CPU plugin IR cache has inconsistent mean image for input " << name;
+                }
+                readData(_istream, meanImage->buffer().as<char*>(), meanImage->byteSize(), "the mean image");
+                preProcess.setMeanImageForChannel(meanImage, c);
+            }
+            c++;
+        }
+        preProcess.setVariant(static_cast<MeanVariant>(GetIntAttr(preProcessNode, "mean-variant")));
+    }
+
+    auto outputs = network.getOutputsInfo();
+    FOREACH_CHILD(outputNode, cnndataNode.child("outputs"), "output") {
+        auto name = GetStrAttr(outputNode, "name");
+        auto found = outputs.find(name);
+        if (found == outputs.end()) {
+            IE_THROW(NetworkNotRead) << "CPU plugin IR cache has no output with name " << name;
+        }
+        found->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        found->second->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Checks that the function can be written as IR v10 and read back without losing information,
+ * i.e. it consists of the standard opset operations only (no TypeRelaxed or plugin internal ops)
+ */
+bool isSerializableFunction(const std::shared_ptr<const ngraph::Function>& function);
+
+/**
+ * Writes CNNNetwork into the CPU plugin IR cache:
+ * xml header with inputs/outputs info followed by the IR xml and weights sections.
+ * The cache holds the IR only, the graph is compiled again on import
+ */
+class CNNNetworkSerializer {
+public:
+    CNNNetworkSerializer(std::ostream& ostream, bool isTransformed);
+    void operator << (const InferenceEngine::CNNNetwork& network);
+
+private:
+    std::ostream& _ostream;
+    bool _isTransformed;
+};
+
+/**
+ * Reads CNNNetwork from the CPU plugin IR cache, throws NetworkNotRead if the stream ends before the network is read.
+ * isTransformed() reports whether common transformations were already applied to the stored network
+ */
+class CNNNetworkDeserializer {
+public:
+    typedef std::function<InferenceEngine::CNNNetwork(const std::string&, const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
+
+    CNNNetworkDeserializer(std::istream& istream, cnn_network_builder fn);
+    void operator >> (InferenceEngine::CNNNetwork& network);
+
+    bool isTransformed() const {
+        return _isTransformed;
+    }
+
+private:
+    std::istream& _istream;
+    cnn_network_builder _cnn_network_builder;
+    bool _isTransformed = false;
+};
+
+}  // namespace MKLDNNPlugin
@@ -7,6 +7,7 @@
 #include <ie_extension.h>
 
 #include <file_utils.h>
+#include <ngraph/op/constant.hpp>
 #include <ngraph_functions/subgraph_builders.hpp>
 #include <functional_test_utils/test_model/test_model.hpp>
 #include <common_test_utils/file_utils.hpp>
@@ -17,7 +18,12 @@
 #include <atomic>
 #include <mutex>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <map>
+#include <vector>
 
 class CoreThreadingTests : public ::testing::Test {
 protected:
@@ -153,3 +159,67 @@ TEST_F(CoreThreadingTests, ReadNetwork) {
         (void)ie.ReadNetwork(modelName, weightsName);
     }, 100, 12);
 }
+
+namespace {
+
+// the constants of the networks read from the same IR have the same names and data
+void compareConstants(const InferenceEngine::CNNNetwork& expected, const InferenceEngine::CNNNetwork& actual) {
+    std::map<std::string, std::shared_ptr<ngraph::op::Constant>> expectedConstants;
+    for (const auto& op : expected.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op))
+            expectedConstants[constant->get_friendly_name()] = constant;
+    }
+    size_t compared = 0;
+    for (const auto& op : actual.getFunction()->get_ops()) {
+        auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op);
+        if (!constant)
+            continue;
+        auto found = expectedConstants.find(constant->get_friendly_name());
+        ASSERT_NE(expectedConstants.end(), found) << constant->get_friendly_name();
+        const auto size = constant->get_output_tensor(0).size();
+        ASSERT_EQ(found->second->get_output_tensor(0).size(), size) << constant->get_friendly_name();
+        ASSERT_EQ(0, std::memcmp(found->second->get_data_ptr(), constant->get_data_ptr(), size)) << constant->get_friendly_name();
+        compared++;
+    }
+    ASSERT_EQ(expectedConstants.size(), compared);
+    ASSERT_NE(0u, compared);
+}
+
+}  // namespace
+
+// tested function: ReadNetwork with memory mapped weights
+TEST_F(CoreThreadingTests, ReadNetworkMMapWeights) {
+    InferenceEngine::Core regularIE;
+    auto regularNetwork = regularIE.ReadNetwork(modelName, weightsName);
+
+    for (auto mapping : {CONFIG_VALUE(YES), CONFIG_VALUE(READ_ONLY)}) {
+        InferenceEngine::Core ie;
+        ie.SetConfig({{ CONFIG_KEY(MMAP_WEIGHTS), mapping }});
+        auto network = ie.ReadNetwork(modelName, weightsName);
+        compareConstants(regularNetwork, network);
+
+        runParallel([&] () {
+            auto localNetwork = ie.ReadNetwork(modelName, weightsName);
+            compareConstants(regularNetwork, localNetwork);
+        }, 20, 12);
+    }
+}
+
+// tested function: ReadNetwork with memory mapped weights of the file shorter than the IR expects
+TEST_F(CoreThreadingTests, ReadNetworkMMapShortWeights) {
+    const std::string shortWeightsName = "CoreThreadingTests_short.bin";
+    {
+        std::ifstream weights(weightsName, std::ios::binary);
+        std::vector<char> data((std::istreambuf_iterator<char>(weights)), std::istreambuf_iterator<char>());
+        ASSERT_FALSE(data.empty());
+        std::ofstream shortWeights(shortWeightsName, std::ios::binary);
+        shortWeights.write(data.data(), data.size() / 2);
+    }
+
+    for (auto mapping : {CONFIG_VALUE(NO), CONFIG_VALUE(YES), CONFIG_VALUE(READ_ONLY)}) {
+        InferenceEngine::Core ie;
+        ie.SetConfig({{ CONFIG_KEY(MMAP_WEIGHTS), mapping }});
+        EXPECT_THROW(ie.ReadNetwork(modelName, shortWeightsName), InferenceEngine::Exception) << mapping;
+    }
+    std::remove(shortWeightsName.c_str());
+}
@@ -211,3 +211,30 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+TEST(CPUStreamsExecutorTests, canRunMoreTasksThanQueuesCapacity) {
+    const int streams = 2;
+    const int numTasks = 10000;
+    std::atomic<int> counter = {0};
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool isBlocked = true;
+    {
+        CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE}};
+        // block the stream threads so the tasks are accumulated in the queues
+        for (int i = 0; i < streams; ++i) {
+            executor.run([&] {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&] { return !isBlocked; });
+            });
+        }
+        for (int i = 0; i < numTasks; ++i) {
+            executor.run([&] { ++counter; });
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isBlocked = false;
+        }
+        cv.notify_all();
+    }
+    ASSERT_EQ(numTasks, counter);
+}
@@ -23,7 +23,14 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "4"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_POOL, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_POOL, InferenceEngine::PluginConfigParams::CPU_MEMORY_POOL_HUGE_PAGES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_KERNEL_CACHE_CAPACITY, "16"}},
+            {{InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES},
+             {InferenceEngine::PluginConfigParams::KEY_CPU_PERF_COUNT_HISTOGRAMS, InferenceEngine::PluginConfigParams::YES}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -69,7 +76,12 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_POOL, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_PERF_COUNT_HISTOGRAMS, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_KERNEL_CACHE_CAPACITY, "-1"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -4,6 +4,7 @@
 
 #include <subgraph_tests/multiple_LSTMCell.hpp>
 #include "common_test_utils/test_constants.hpp"
+#include "ie_plugin_config.hpp"
 
 namespace SubgraphTestsDefinitions {
 namespace {
@@ -32,6 +33,10 @@ std::vector<size_t> hidden_sizes = {
 
 std::map<std::string, std::string> additional_config = {
 };
+
+std::map<std::string, std::string> dataflow_config = {
+    {InferenceEngine::PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, InferenceEngine::PluginConfigParams::YES}
+};
 } // namespace
 
 
@@ -44,4 +49,15 @@ INSTANTIATE_TEST_SUITE_P(MultipleLSTMCellTest, MultipleLSTMCellTest,
         ::testing::ValuesIn(hidden_sizes),
         ::testing::Values(additional_config)),
     MultipleLSTMCellTest::getTestCaseName);
-} // namespace SubgraphTestsDefinitions
\ No newline at end of file
+
+INSTANTIATE_TEST_SUITE_P(smoke_MultipleLSTMCellTest_Dataflow, MultipleLSTMCellTest,
+    ::testing::Combine(
+        ::testing::Values(ngraph::helpers::MemoryTransformation::NONE,
+                          ngraph::helpers::MemoryTransformation::LOW_LATENCY_V2),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::Values(InferenceEngine::Precision::FP32),
+        ::testing::ValuesIn(input_sizes),
+        ::testing::ValuesIn(hidden_sizes),
+        ::testing::Values(dataflow_config)),
+    MultipleLSTMCellTest::getTestCaseName);
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,104 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ * Independent branches over the in-place outputs of Split, joined by the in-place Concat:
+ *
+ *   X -> Split(axis 1) -> [ Multiply -> Tanh -> Add(split output) -> Reshape -> Reshape ] x branches -> Concat -> Multiply -> Y
+ *   X -> Sigmoid -----------------------------------------------------------------------------------------------^
+ *   first branch -> Z
+ *
+ * The branch nodes of the same type run concurrently in the dataflow mode, the intermediate tensors share
+ * the workspace, so the nodes of the different branches are ordered also by the reused memory. The elementwise
+ * results don't depend on the threads splitting the work, so the dataflow and the sequential outputs are equal bitwise.
+ */
+class DataflowExecutionTest : public testing::WithParamInterface<size_t>,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<size_t> obj) {
+        std::ostringstream result;
+        result << "branches=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration = {{PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, PluginConfigParams::YES}};
+        const size_t branches = GetParam();
+        const size_t channels = 8;
+
+        auto params = builder::makeParams(element::f32, {{1, branches * channels, 16, 16}});
+        auto split = std::make_shared<opset1::Split>(params[0], opset1::Constant::create(element::i64, {}, {1}), branches);
+
+        OutputVector branchOutputs;
+        for (size_t i = 0; i < branches; i++) {
+            auto scale = builder::makeConstant<float>(element::f32, {1}, {0.5f + i});
+            auto tanh = std::make_shared<opset1::Tanh>(std::make_shared<opset1::Multiply>(split->output(i), scale));
+            auto add = std::make_shared<opset1::Add>(tanh, split->output(i));
+            auto flatShape = opset1::Constant::create(element::i64, {3}, std::vector<size_t>{1, channels, 256});
+            auto flat = std::make_shared<opset1::Reshape>(add, flatShape, false);
+            auto shape = opset1::Constant::create(element::i64, {4}, std::vector<size_t>{1, channels, 16, 16});
+            branchOutputs.push_back(std::make_shared<opset1::Reshape>(flat, shape, false));
+        }
+        auto concat = std::make_shared<opset1::Concat>(branchOutputs, 1);
+        auto y = std::make_shared<opset1::Multiply>(concat, std::make_shared<opset1::Sigmoid>(params[0]));
+
+        ResultVector results{std::make_shared<opset1::Result>(y), std::make_shared<opset1::Result>(branchOutputs[0])};
+        function = std::make_shared<Function>(results, params, "DataflowExecution");
+    }
+
+    std::vector<std::vector<uint8_t>> getOutputData() {
+        std::vector<std::vector<uint8_t>> data;
+        for (const auto &output : GetOutputs()) {
+            auto memory = as<MemoryBlob>(output);
+            IE_ASSERT(memory);
+            const auto lockedMemory = memory->rmap();
+            const auto buffer = lockedMemory.as<const uint8_t *>();
+            data.emplace_back(buffer, buffer + memory->byteSize());
+        }
+        return data;
+    }
+};
+
+TEST_P(DataflowExecutionTest, CompareWithSequential) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    const auto dataflowOutputs = getOutputData();
+
+    configuration[PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION] = PluginConfigParams::NO;
+    LoadNetwork();
+    Infer();
+    ASSERT_EQ(dataflowOutputs, getOutputData());
+
+    // the order of the concurrent nodes differs between the inferences, the reused memory must stay valid for any of them
+    configuration[PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION] = PluginConfigParams::YES;
+    LoadNetwork();
+    for (int i = 0; i < 20; i++) {
+        Infer();
+        ASSERT_EQ(dataflowOutputs, getOutputData());
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_DataflowExecution, DataflowExecutionTest,
+                         ::testing::Values(2, 4, 8),
+                         DataflowExecutionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,103 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+const ngraph::Shape inputShape = {1, 8};
+
+// Chain of tiny additions, every value is used by the two following additions, so the nodes are not fused
+std::shared_ptr<ngraph::Function> makeAddChain(size_t length) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, inputShape);
+    ngraph::Output<ngraph::Node> previous = param;
+    ngraph::Output<ngraph::Node> current = std::make_shared<ngraph::opset1::Relu>(param);
+    for (size_t i = 0; i < length; i++) {
+        auto next = std::make_shared<ngraph::opset1::Add>(current, previous);
+        previous = current;
+        current = next;
+    }
+    auto result = std::make_shared<ngraph::opset1::Result>(current);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}, "AddChain");
+}
+
+std::vector<float> calculateAddChain(const std::vector<float>& input, size_t length) {
+    std::vector<float> output(input.size());
+    for (size_t j = 0; j < input.size(); j++) {
+        float previous = input[j];
+        float current = std::max(input[j], 0.f);
+        for (size_t i = 0; i < length; i++) {
+            const float next = current + previous;
+            previous = current;
+            current = next;
+        }
+        output[j] = current;
+    }
+    return output;
+}
+
+void checkOutput(InferRequest& request, const std::string& outputName, const std::vector<float>& expected) {
+    auto output = request.GetBlob(outputName);
+    const auto data = output->cbuffer().as<const float*>();
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_FLOAT_EQ(expected[i], data[i]) << "element " << i;
+    }
+}
+
+}  // namespace
+
+// The execution loop of the graph skips the constant nodes, collects the performance counters only if they are
+// enabled and checks the cancellation every few nodes, so the chains longer than the check period are inferred
+TEST(InferAddChainTest, MatchesReference) {
+    Core core;
+    for (size_t length : {3, 17, 100}) {
+        CNNNetwork network(makeAddChain(length));
+        const auto outputName = network.getOutputsInfo().begin()->first;
+        const auto inputName = network.getInputsInfo().begin()->first;
+        for (auto perfCount : {PluginConfigParams::NO, PluginConfigParams::YES}) {
+            SCOPED_TRACE("length " + std::to_string(length) + ", PERF_COUNT " + perfCount);
+            auto execNetwork = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                                {{PluginConfigParams::KEY_PERF_COUNT, perfCount}});
+            auto request = execNetwork.CreateInferRequest();
+
+            std::vector<float> input = {-1.f, -0.5f, -0.25f, 0.f, 0.25f, 0.5f, 0.75f, 1.f};
+            auto inputBlob = make_shared_blob<float>({Precision::FP32, inputShape, Layout::NC}, input.data());
+            request.SetBlob(inputName, inputBlob);
+            const auto expected = calculateAddChain(input, length);
+
+            request.Infer();
+            checkOutput(request, outputName, expected);
+
+            // the cancellation of the previous inference doesn't affect the next one
+            request.StartAsync();
+            request.Cancel();
+            try {
+                request.Wait(InferRequest::WaitMode::RESULT_READY);
+            } catch (const InferCancelled&) {
+            }
+            request.StartAsync();
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+            checkOutput(request, outputName, expected);
+
+            if (perfCount == PluginConfigParams::YES) {
+                ASSERT_FALSE(request.GetPerformanceCounts().empty());
+            }
+        }
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
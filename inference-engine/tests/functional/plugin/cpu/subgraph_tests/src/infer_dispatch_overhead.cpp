@@ -0,0 +1,69 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include "common_test_utils/perf_test_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+// Chain of tiny additions, every value is used by the two following additions, so the nodes are not fused
+std::shared_ptr<ngraph::Function> makeAddChain(size_t length) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8});
+    ngraph::Output<ngraph::Node> previous = param;
+    ngraph::Output<ngraph::Node> current = std::make_shared<ngraph::opset1::Relu>(param);
+    for (size_t i = 0; i < length; i++) {
+        auto next = std::make_shared<ngraph::opset1::Add>(current, previous);
+        previous = current;
+        current = next;
+    }
+    auto result = std::make_shared<ngraph::opset1::Result>(current);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}, "AddChain");
+}
+
+}  // namespace
+
+// Measures the per node overhead of the graph execution loop on the chains of the nodes doing almost nothing,
+// the times in us are reported as the test properties
+TEST(InferDispatchOverheadBenchmark, DISABLED_add_chain) {
+    const int iterations = 2000;
+    Core core;
+    for (size_t length : {100, 1000, 5000}) {
+        CNNNetwork network(makeAddChain(length));
+        for (auto perfCount : {PluginConfigParams::NO, PluginConfigParams::YES}) {
+            std::map<std::string, std::string> config = {{PluginConfigParams::KEY_PERF_COUNT, perfCount},
+                                                         {PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}};
+            auto execNetwork = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+            size_t nodes = 0;
+            for (const auto& op : execNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+                if (!ngraph::op::is_parameter(op) && !ngraph::op::is_output(op))
+                    nodes++;
+            }
+
+            // the async request checks the cancellation as the applications normally use it
+            auto request = execNetwork.CreateInferRequest();
+            const double perInference = CommonTestUtils::measureAverageMs([&]() {
+                request.StartAsync();
+                request.Wait(InferRequest::WaitMode::RESULT_READY);
+            }, iterations) * 1.e3;
+
+            const auto name = "nodes" + std::to_string(nodes) + "_perf_count_" + perfCount;
+            CommonTestUtils::reportPerfValue(name + "_us_per_inference", perInference);
+            CommonTestUtils::reportPerfValue(name + "_us_per_node", perInference / nodes);
+        }
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,126 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/perf_test_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+// Counts the data TLB load misses of the calling thread, not available if the kernel or the CPU doesn't expose the event
+class DtlbMissCounter {
+public:
+    DtlbMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        _fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~DtlbMissCounter() {
+#if defined(__linux__)
+        if (_fd >= 0)
+            close(_fd);
+#endif
+    }
+
+    bool available() const { return _fd >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    uint64_t stop() {
+        uint64_t count = 0;
+#if defined(__linux__)
+        ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(_fd, &count, sizeof(count)) != sizeof(count))
+            count = 0;
+#endif
+        return count;
+    }
+
+private:
+    int _fd = -1;
+};
+
+// Chain of 1x1 convolutions on the activations of several MB, so the workspace spans many 4K pages
+std::shared_ptr<ngraph::Function> makeConvChain(size_t length) {
+    const size_t channels = 32;
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, channels, 256, 256});
+    ngraph::Output<ngraph::Node> current = param;
+    for (size_t i = 0; i < length; i++) {
+        std::vector<float> weights(channels * channels);
+        for (size_t j = 0; j < weights.size(); j++)
+            weights[j] = static_cast<float>((i + j) % 7) * 0.05f - 0.15f;
+        auto weightsNode = ngraph::opset1::Constant::create(ngraph::element::f32, {channels, channels, 1, 1}, weights);
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(current, weightsNode, ngraph::Strides{1, 1},
+                                                                  ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0},
+                                                                  ngraph::Strides{1, 1});
+        current = std::make_shared<ngraph::opset1::Relu>(conv);
+    }
+    auto result = std::make_shared<ngraph::opset1::Result>(current);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}, "ConvChain");
+}
+
+}  // namespace
+
+// Compares the latency and the data TLB load misses per inference of the memory pool modes,
+// the values are reported as the test properties. The sync inference runs in the calling thread,
+// so the TLB misses of the single inference thread are counted
+TEST(MemoryPoolBenchmark, DISABLED_conv_chain) {
+    const int iterations = 100;
+    Core core;
+    CNNNetwork network(makeConvChain(8));
+    for (auto mode : {PluginConfigParams::NO, PluginConfigParams::YES, PluginConfigParams::CPU_MEMORY_POOL_HUGE_PAGES}) {
+        std::map<std::string, std::string> config = {{PluginConfigParams::KEY_CPU_MEMORY_POOL, mode},
+                                                     {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"},
+                                                     {PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}};
+        auto execNetwork = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+        auto request = execNetwork.CreateInferRequest();
+
+        const std::string name = std::string("memory_pool_") + mode;
+        CommonTestUtils::reportPerfValue(name + "_ms_per_inference",
+                                         CommonTestUtils::measureAverageMs([&]() { request.Infer(); }, iterations));
+
+        DtlbMissCounter counter;
+        if (!counter.available())
+            continue;
+        counter.start();
+        for (int i = 0; i < iterations; i++)
+            request.Infer();
+        CommonTestUtils::reportPerfValue(name + "_dtlb_load_misses_per_inference", static_cast<double>(counter.stop()) / iterations);
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,123 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+// The mean and the scale are executed by the graph, so the input of any precision and layout is normalized
+// while it's read, and the input blob itself is left untouched
+TEST(PreprocessingInGraphTest, smoke_MeanValueAndScaleU8NHWC) {
+    const size_t channels = 3, height = 4, width = 5;
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, channels, height, width});
+    param->set_friendly_name("param");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    CNNNetwork network(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+
+    const std::vector<float> meanValues = {10.f, 20.f, 30.f};
+    const std::vector<float> stdScales = {2.f, 4.f, 0.5f};
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->setLayout(Layout::NHWC);
+    auto& preProcess = inputInfo->getPreProcess();
+    preProcess.init(channels);
+    for (size_t c = 0; c < channels; c++) {
+        preProcess[c]->meanValue = meanValues[c];
+        preProcess[c]->stdScale = stdScales[c];
+    }
+    preProcess.setVariant(MEAN_VALUE);
+    network.getOutputsInfo().begin()->second->setPrecision(Precision::FP32);
+
+    Core core;
+    auto execNetwork = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto request = execNetwork.CreateInferRequest();
+
+    auto input = request.GetBlob("param");
+    auto inputData = input->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < input->size(); i++)
+        inputData[i] = static_cast<uint8_t>(i * 7 % 64);
+
+    request.Infer();
+
+    auto output = request.GetBlob(network.getOutputsInfo().begin()->first);
+    const auto& outputDesc = output->getTensorDesc();
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t c = 0; c < channels; c++) {
+        for (size_t h = 0; h < height; h++) {
+            for (size_t w = 0; w < width; w++) {
+                const size_t nhwcOffset = (h * width + w) * channels + c;
+                ASSERT_EQ(static_cast<uint8_t>(nhwcOffset * 7 % 64), inputData[nhwcOffset]);
+                const float expected = std::max(0.f, (inputData[nhwcOffset] - meanValues[c]) / stdScales[c]);
+                ASSERT_NEAR(expected, outputData[outputDesc.offset({0, c, h, w})], 1e-5f);
+            }
+        }
+    }
+}
+
+namespace {
+
+CNNNetwork makeMeanImageNetwork(size_t channels) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, channels, 2, 2});
+    param->set_friendly_name("param");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    relu->set_friendly_name("relu");
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    CNNNetwork network(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+    auto& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+    preProcess.init(channels);
+    preProcess.setVariant(MEAN_IMAGE);
+    return network;
+}
+
+}  // namespace
+
+// the preprocessing operations are inserted by LoadNetwork only, so the query reports the layers of the network
+TEST(PreprocessingInGraphTest, smoke_QueryNetworkReportsNetworkLayers) {
+    auto network = makeMeanImageNetwork(3);
+    auto& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+    for (size_t c = 0; c < 3; c++) {
+        preProcess[c]->meanData = make_shared_blob<float>({Precision::FP32, {2, 2}, Layout::HW});
+        preProcess[c]->meanData->allocate();
+    }
+
+    Core core;
+    auto result = core.QueryNetwork(network, CommonTestUtils::DEVICE_CPU);
+    for (const auto& layer : result.supportedLayersMap) {
+        ASSERT_EQ(std::string::npos, layer.first.find("/MeanImage")) << layer.first;
+    }
+    ASSERT_EQ(1u, result.supportedLayersMap.count("relu"));
+}
+
+TEST(PreprocessingInGraphTest, smoke_MissingMeanImageThrows) {
+    auto network = makeMeanImageNetwork(3);
+
+    Core core;
+    ASSERT_THROW(core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU), Exception);
+}
+
+// the mean image isn't broadcast to the input of another height or width
+TEST(PreprocessingInGraphTest, smoke_MeanImageOfOtherSizeThrows) {
+    auto network = makeMeanImageNetwork(3);
+    auto& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+    for (size_t c = 0; c < 3; c++) {
+        preProcess[c]->meanData = make_shared_blob<float>({Precision::FP32, {1, 4}, Layout::HW});
+        preProcess[c]->meanData->allocate();
+    }
+
+    Core core;
+    ASSERT_THROW(core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU), Exception);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
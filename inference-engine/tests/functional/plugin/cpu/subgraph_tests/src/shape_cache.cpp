@@ -0,0 +1,113 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+const std::vector<float> channelScales = {0.5f, -1.f, 2.f};
+
+// Relu(x * scale) averaged over the width, so the output shape depends on every input dimension but the width
+std::shared_ptr<ngraph::Function> makeScaleReluMean() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+    auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, {1, 3, 1, 1}, channelScales);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(std::make_shared<ngraph::opset1::Multiply>(param, scale));
+    auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, {1}, {3});
+    auto mean = std::make_shared<ngraph::opset1::ReduceMean>(relu, axes, true);
+    auto result = std::make_shared<ngraph::opset1::Result>(mean);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}, "ScaleReluMean");
+}
+
+std::vector<float> makeInput(const SizeVector& dims) {
+    std::vector<float> input(std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<size_t>()));
+    for (size_t i = 0; i < input.size(); i++)
+        input[i] = static_cast<float>(static_cast<int>(i % 11) - 5) * 0.25f;
+    return input;
+}
+
+std::vector<float> calculateScaleReluMean(const std::vector<float>& input, const SizeVector& dims) {
+    const size_t channels = dims[1], height = dims[2], width = dims[3];
+    std::vector<float> output(dims[0] * channels * height);
+    for (size_t i = 0; i < output.size(); i++) {
+        const float scale = channelScales[(i / height) % channels];
+        float sum = 0.f;
+        for (size_t w = 0; w < width; w++)
+            sum += std::max(input[i * width + w] * scale, 0.f);
+        output[i] = sum / width;
+    }
+    return output;
+}
+
+void inferAndCheck(InferRequest& request, const std::string& inputName, const std::string& outputName,
+                   const SizeVector& dims) {
+    auto input = makeInput(dims);
+    request.SetBlob(inputName, make_shared_blob<float>({Precision::FP32, dims, Layout::NCHW}, input.data()));
+    request.Infer();
+
+    // the output blob is reallocated for the new shapes, so it is queried after the inference
+    auto output = request.GetBlob(outputName);
+    const SizeVector expectedDims = {dims[0], dims[1], dims[2], 1};
+    ASSERT_EQ(expectedDims, output->getTensorDesc().getDims());
+    const auto expected = calculateScaleReluMean(input, dims);
+    const auto data = output->cbuffer().as<const float*>();
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_FLOAT_EQ(expected[i], data[i]) << "element " << i;
+    }
+}
+
+}  // namespace
+
+TEST(ShapeCacheTest, InfersOtherShapes) {
+    Core core;
+    CNNNetwork network(makeScaleReluMean());
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    for (auto streams : {"1", "2"}) {
+        SCOPED_TRACE(std::string("streams ") + streams);
+        auto execNetwork = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                            {{PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "2"},
+                                             {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams}});
+        auto request = execNetwork.CreateInferRequest();
+
+        // the network shapes don't use the cache, the second inference of the shapes finds their graph
+        const std::vector<SizeVector> shapes = {{1, 3, 4, 4}, {2, 3, 5, 7}, {1, 3, 8, 2}, {2, 3, 5, 7}, {1, 3, 8, 2},
+                                                {1, 3, 4, 4}};
+        for (const auto& dims : shapes) {
+            inferAndCheck(request, inputName, outputName, dims);
+        }
+
+        const auto hits = execNetwork.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_HITS)).as<uint64_t>();
+        const auto misses = execNetwork.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_MISSES)).as<uint64_t>();
+        ASSERT_EQ(4u, hits + misses);
+        if (std::string(streams) == "1") {
+            ASSERT_EQ(2u, hits);
+            ASSERT_EQ(2u, misses);
+        }
+
+        // the third shapes evict the least recently used ones
+        inferAndCheck(request, inputName, outputName, {3, 3, 2, 5});
+        inferAndCheck(request, inputName, outputName, {2, 3, 5, 7});
+        ASSERT_EQ(6u, execNetwork.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_HITS)).as<uint64_t>() +
+                     execNetwork.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_MISSES)).as<uint64_t>());
+        if (std::string(streams) == "1") {
+            ASSERT_EQ(4u, execNetwork.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_MISSES)).as<uint64_t>());
+        }
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
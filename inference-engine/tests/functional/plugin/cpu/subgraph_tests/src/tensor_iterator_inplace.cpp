@@ -0,0 +1,148 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset5.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+using TensorIteratorInPlaceTestParams = std::tuple<bool,      // Loop instead of TensorIterator
+                                                   size_t,    // number of iterations
+                                                   int64_t,   // slicing axis
+                                                   int64_t>;  // slicing stride
+
+/*
+ * The body covers the node paths avoiding the copies between the iterations:
+ *
+ *   W (invariant) -> Multiply -> Relu -> Add = Inv     invariant subgraph, executed by the first iteration only
+ *   H = Tanh(X * Inv + H_prev)                         X sliced input, H back edge
+ *   Y = H * Inv                                        concatenated output
+ *
+ * The outputs are the concatenated H and Y, the last H and the invariant Inv. The sliced chunks of the axis 0 have the
+ * plain layout of the body tensors, so they are read and written in place, the other axes are copied.
+ */
+class TensorIteratorInPlaceTest : public testing::WithParamInterface<TensorIteratorInPlaceTestParams>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<TensorIteratorInPlaceTestParams> obj) {
+        bool isLoop;
+        size_t iterations;
+        int64_t axis, stride;
+        std::tie(isLoop, iterations, axis, stride) = obj.param;
+
+        std::ostringstream result;
+        result << (isLoop ? "Loop" : "TensorIterator") << "_";
+        result << "iterations=" << iterations << "_";
+        result << "axis=" << axis << "_";
+        result << "stride=" << stride;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        bool isLoop;
+        size_t iterations;
+        int64_t axis, stride;
+        std::tie(isLoop, iterations, axis, stride) = this->GetParam();
+
+        Shape chunkShape{2, 3, 4};
+        chunkShape[axis] = 1;
+        Shape inputShape = chunkShape;
+        inputShape[axis] = iterations;
+
+        auto params = builder::makeParams(element::f32, {inputShape, chunkShape, chunkShape});
+        params[0]->set_friendly_name("X");
+        params[1]->set_friendly_name("H");
+        params[2]->set_friendly_name("W");
+
+        auto bodyX = std::make_shared<opset5::Parameter>(element::f32, chunkShape);
+        auto bodyH = std::make_shared<opset5::Parameter>(element::f32, chunkShape);
+        auto bodyW = std::make_shared<opset5::Parameter>(element::f32, chunkShape);
+
+        auto scale = builder::makeConstant<float>(element::f32, {1}, {2.f});
+        auto shift = builder::makeConstant<float>(element::f32, {1}, {0.25f});
+        auto inv = std::make_shared<opset5::Add>(
+                std::make_shared<opset5::Relu>(std::make_shared<opset5::Multiply>(bodyW, scale)), shift);
+        auto h = std::make_shared<opset5::Tanh>(
+                std::make_shared<opset5::Add>(std::make_shared<opset5::Multiply>(bodyX, inv), bodyH));
+        auto y = std::make_shared<opset5::Multiply>(h, inv);
+
+        ResultVector bodyResults{std::make_shared<opset5::Result>(h), std::make_shared<opset5::Result>(y),
+                                 std::make_shared<opset5::Result>(inv)};
+        std::shared_ptr<op::util::SubGraphOp> subGraph;
+        if (isLoop) {
+            bodyResults.push_back(std::make_shared<opset5::Result>(opset5::Constant::create(element::boolean, {1}, {true})));
+            auto tripCount = opset5::Constant::create(element::i64, {1}, {static_cast<int64_t>(iterations)});
+            auto execCondition = opset5::Constant::create(element::boolean, {1}, {true});
+            auto loop = std::make_shared<opset5::Loop>(tripCount, execCondition);
+            loop->set_special_body_ports({-1, 3});
+            subGraph = loop;
+        } else {
+            subGraph = std::make_shared<opset5::TensorIterator>();
+        }
+        subGraph->set_function(std::make_shared<Function>(bodyResults, ParameterVector{bodyX, bodyH, bodyW}));
+
+        const int64_t start = stride > 0 ? 0 : -1;
+        const int64_t end = stride > 0 ? -1 : 0;
+        subGraph->set_sliced_input(bodyX, params[0], start, stride, 1, end, axis);
+        subGraph->set_merged_input(bodyH, params[1], bodyResults[0]);
+        subGraph->set_invariant_input(bodyW, params[2]);
+
+        ResultVector results{
+            std::make_shared<opset5::Result>(subGraph->get_concatenated_slices(bodyResults[0], start, stride, 1, end, axis)),
+            std::make_shared<opset5::Result>(subGraph->get_concatenated_slices(bodyResults[1], start, stride, 1, end, axis)),
+            std::make_shared<opset5::Result>(subGraph->get_iter_value(bodyResults[0], -1)),
+            std::make_shared<opset5::Result>(subGraph->get_iter_value(bodyResults[2], -1))};
+        function = std::make_shared<Function>(results, params, "TensorIteratorInPlace");
+    }
+
+    Blob::Ptr GenerateInput(const InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 20, -10, 10, seed);
+    }
+
+    int seed = 1;
+};
+
+TEST_P(TensorIteratorInPlaceTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the invariant subgraph and the swapped back edge buffers are set up again by the next inference
+    seed = 2;
+    inputs.clear();
+    GenerateInputs();
+    Infer();
+    Validate();
+}
+
+namespace {
+
+const std::vector<size_t> iterations = {1, 3};
+const std::vector<int64_t> axes = {0, 1, 2};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIterator, TensorIteratorInPlaceTest,
+                         ::testing::Combine(::testing::Values(false),
+                                            ::testing::ValuesIn(iterations),
+                                            ::testing::ValuesIn(axes),
+                                            ::testing::Values<int64_t>(1, -1)),
+                         TensorIteratorInPlaceTest::getTestCaseName);
+
+// Loop supports the forward slicing only
+INSTANTIATE_TEST_SUITE_P(smoke_Loop, TensorIteratorInPlaceTest,
+                         ::testing::Combine(::testing::Values(true),
+                                            ::testing::ValuesIn(iterations),
+                                            ::testing::ValuesIn(axes),
+                                            ::testing::Values<int64_t>(1)),
+                         TensorIteratorInPlaceTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
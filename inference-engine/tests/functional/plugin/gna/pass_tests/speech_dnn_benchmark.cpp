@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/perf_test_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// Topology of the DNN acoustic models of speech_sample: 440 spliced input features (11 frames of 40 filter banks),
+// fully connected hidden layers with sigmoid and a senone output layer, one row per frame of the batch
+std::shared_ptr<ngraph::Function> makeSpeechDnn(size_t frames) {
+    const std::vector<size_t> layers = {440, 2048, 2048, 2048, 2048, 3425};
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{frames, layers[0]});
+    ngraph::Output<ngraph::Node> current = param;
+    for (size_t i = 1; i < layers.size(); i++) {
+        std::vector<float> weights(layers[i - 1] * layers[i]);
+        for (size_t j = 0; j < weights.size(); j++)
+            weights[j] = static_cast<float>((i + j) % 17) * 0.002f - 0.016f;
+        auto weightsNode = ngraph::opset1::Constant::create(ngraph::element::f32, {layers[i], layers[i - 1]}, weights);
+        auto biasNode = ngraph::opset1::Constant::create(ngraph::element::f32, {1, layers[i]}, std::vector<float>(layers[i], 0.1f));
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(current, weightsNode, false, true);
+        current = std::make_shared<ngraph::opset1::Add>(matmul, biasNode);
+        if (i + 1 < layers.size())
+            current = std::make_shared<ngraph::opset1::Sigmoid>(current);
+    }
+    auto result = std::make_shared<ngraph::opset1::Result>(current);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}, "SpeechDnn");
+}
+
+}  // namespace
+
+// Latency of the speech_sample DNN in the software emulation with the float kernels for the batch sizes of
+// speech_sample (-bs 1..8), the values are reported as the test properties. The per-kernel comparison with
+// the naive loops is GNAFloatMathBenchmark of gnaUnitTests
+TEST(GNASpeechDnnBenchmark, DISABLED_sw_fp32) {
+    const int iterations = 20;
+    Core core;
+    for (size_t frames : {1, 4, 8}) {
+        CNNNetwork network(makeSpeechDnn(frames));
+        auto execNetwork = core.LoadNetwork(network, CommonTestUtils::DEVICE_GNA,
+                                            {{GNAConfigParams::KEY_GNA_DEVICE_MODE, GNAConfigParams::GNA_SW_FP32}});
+        auto request = execNetwork.CreateInferRequest();
+
+        const auto ms = CommonTestUtils::measureAverageMs([&]() { request.Infer(); }, iterations);
+        const auto name = "speech_dnn_frames_" + std::to_string(frames);
+        CommonTestUtils::reportPerfValue(name + "_ms_per_inference", ms);
+        CommonTestUtils::reportPerfValue(name + "_ms_per_frame", ms / frames);
+    }
+}
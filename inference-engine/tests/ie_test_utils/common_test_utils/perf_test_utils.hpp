@@ -0,0 +1,45 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cctype>
+#include <chrono>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace CommonTestUtils {
+
+/**
+ * @brief Average duration of the function call in milliseconds. The first call warms up the caches and isn't measured
+ */
+template <typename Function>
+double measureAverageMs(Function&& function, int iterations) {
+    function();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        function();
+    const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    return duration.count() / iterations;
+}
+
+/**
+ * @brief Records the measured value as a property of the current test instead of printing it.
+ * The values are collected from the report written with --gtest_output=xml:<file>.
+ * The characters which aren't allowed in the xml attribute names are replaced by '_'
+ */
+inline void reportPerfValue(const std::string& name, double value) {
+    std::string key = name;
+    for (auto& c : key) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '.' && c != '-')
+            c = '_';
+    }
+    std::ostringstream stream;
+    stream << value;
+    ::testing::Test::RecordProperty(key, stream.str());
+}
+
+}  // namespace CommonTestUtils
@@ -0,0 +1,172 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "nodes/common/box_nms.hpp"
+#include "nodes/common/score_select.h"
+
+using namespace InferenceEngine::Extensions::Cpu;
+using MKLDNNPlugin::select_top_scores;
+
+namespace {
+
+struct Box {
+    float x0, y0, x1, y1;
+};
+
+// boxes of different sizes in a small area, so many of them overlap
+std::vector<Box> makeBoxes(int num, float scale, std::mt19937& gen) {
+    std::uniform_real_distribution<float> position(0.f, 10.f * scale);
+    std::uniform_real_distribution<float> size(0.f, 3.f * scale);
+    std::vector<Box> boxes(num);
+    for (auto& box : boxes) {
+        box.x0 = position(gen);
+        box.y0 = position(gen);
+        box.x1 = box.x0 + size(gen);
+        box.y1 = box.y0 + size(gen);
+    }
+    // degenerate and touching boxes
+    if (num > 2) {
+        boxes[1].x1 = boxes[1].x0;
+        boxes[2].x0 = boxes[0].x1;
+    }
+    return boxes;
+}
+
+float referenceIoU(const Box& a, const Box& b, float offset) {
+    const float areaA = (a.x1 - a.x0 + offset) * (a.y1 - a.y0 + offset);
+    const float areaB = (b.x1 - b.x0 + offset) * (b.y1 - b.y0 + offset);
+    if (areaA <= 0.f || areaB <= 0.f)
+        return 0.f;
+    if (a.x0 > b.x1 || b.x0 > a.x1 || a.y0 > b.y1 || b.y0 > a.y1)
+        return 0.f;
+    const float width = std::max(0.f, std::min(a.x1, b.x1) - std::max(a.x0, b.x0) + offset);
+    const float height = std::max(0.f, std::min(a.y1, b.y1) - std::max(a.y0, b.y0) + offset);
+    const float intersection = width * height;
+    return intersection / (areaA + areaB - intersection);
+}
+
+// every selected box suppresses all the following ones
+std::vector<int> referenceNms(const std::vector<Box>& boxes, const std::vector<int>& order, int maxSelected, const nms_conf& conf) {
+    std::vector<bool> suppressed(order.size(), false);
+    std::vector<int> selected;
+    for (size_t i = 0; i < order.size() && static_cast<int>(selected.size()) != maxSelected; i++) {
+        if (suppressed[i])
+            continue;
+        selected.push_back(order[i]);
+        for (size_t j = i + 1; j < order.size(); j++) {
+            const float iou = referenceIoU(boxes[order[i]], boxes[order[j]], conf.coordinates_offset);
+            if (conf.suppress_equal ? iou >= conf.iou_threshold : iou > conf.iou_threshold)
+                suppressed[j] = true;
+        }
+    }
+    return selected;
+}
+
+}  // namespace
+
+using BoxNmsParams = std::tuple<int, float, bool, int>;
+
+class BoxNmsTest : public ::testing::TestWithParam<BoxNmsParams> {};
+
+TEST_P(BoxNmsTest, MatchesReference) {
+    int num, maxSelected;
+    float threshold;
+    bool suppressEqual;
+    std::tie(num, threshold, suppressEqual, maxSelected) = GetParam();
+
+    std::mt19937 gen(num);
+    for (float offset : {0.f, 1.f}) {
+        const auto boxes = makeBoxes(num, offset == 0.f ? 0.1f : 10.f, gen);
+        std::vector<int> order(num);
+        for (int i = 0; i < num; i++)
+            order[i] = i;
+        std::shuffle(order.begin(), order.end(), gen);
+
+        const nms_conf conf = {threshold, offset, suppressEqual};
+        const auto ref = referenceNms(boxes, order, maxSelected, conf);
+
+        std::vector<int> selected(num);
+        const int count = XARCH::nms_boxes(&boxes[0].x0, &boxes[0].y0, &boxes[0].x1, &boxes[0].y1, 4,
+                                           order.data(), num, maxSelected, conf, selected.data());
+        selected.resize(count);
+        ASSERT_EQ(ref, selected) << "coordinates offset " << offset;
+
+        // the same boxes in separate arrays in the selection order
+        std::vector<float> x0(num), y0(num), x1(num), y1(num);
+        for (int i = 0; i < num; i++) {
+            x0[i] = boxes[order[i]].x0;
+            y0[i] = boxes[order[i]].y0;
+            x1[i] = boxes[order[i]].x1;
+            y1[i] = boxes[order[i]].y1;
+        }
+        std::vector<int> sorted(num);
+        const int sortedCount = XARCH::nms_boxes(x0.data(), y0.data(), x1.data(), y1.data(), 1,
+                                                 nullptr, num, maxSelected, conf, sorted.data());
+        ASSERT_EQ(count, sortedCount);
+        for (int i = 0; i < count; i++)
+            ASSERT_EQ(selected[i], order[sorted[i]]);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(BoxNms, BoxNmsTest,
+    ::testing::Combine(::testing::Values(1, 7, 40, 300),
+                       ::testing::Values(0.f, 0.3f, 0.7f),
+                       ::testing::Bool(),
+                       ::testing::Values(-1, 5)));
+
+TEST(BoxNmsTest, IdenticalBoxesAreSuppressedByEqualIoU) {
+    const std::vector<float> box = {0.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f, 1.f};
+    std::vector<int> selected(2);
+
+    ASSERT_EQ(2, XARCH::nms_boxes(&box[0], &box[1], &box[2], &box[3], 4, nullptr, 2, -1, {1.f, 0.f, false}, selected.data()));
+    ASSERT_EQ(1, XARCH::nms_boxes(&box[0], &box[1], &box[2], &box[3], 4, nullptr, 2, -1, {1.f, 0.f, true}, selected.data()));
+}
+
+using SelectTopScoresParams = std::tuple<int, int>;
+
+class SelectTopScoresTest : public ::testing::TestWithParam<SelectTopScoresParams> {};
+
+TEST_P(SelectTopScoresTest, MatchesPartialSort) {
+    int num, topK;
+    std::tie(num, topK) = GetParam();
+
+    std::mt19937 gen(num);
+    // few distinct values of both signs to get many equal scores
+    std::uniform_int_distribution<int> distribution(-20, 20);
+    std::vector<float> scores(num);
+    for (auto& score : scores)
+        score = distribution(gen) / 8.f;
+    if (num > 2) {
+        scores[0] = -0.f;
+        scores[1] = 0.f;
+    }
+
+    for (float threshold : {-std::numeric_limits<float>::infinity(), 0.f, 1.5f}) {
+        std::vector<int> filtered;
+        for (int i = 0; i < num; i++) {
+            if (scores[i] > threshold)
+                filtered.push_back(i);
+        }
+        std::vector<int> ref(topK < 0 ? filtered.size() : std::min<size_t>(topK, filtered.size()));
+        std::partial_sort_copy(filtered.begin(), filtered.end(), ref.begin(), ref.end(), [&](int i, int j) {
+            return scores[i] > scores[j] || (scores[i] == scores[j] && i < j);
+        });
+
+        std::vector<int> indices(num);
+        indices.resize(select_top_scores(scores.data(), num, threshold, topK, indices.data()));
+        ASSERT_EQ(ref, indices) << "threshold " << threshold;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SelectTopScores, SelectTopScoresTest,
+    ::testing::Combine(::testing::Values(1, 10, 1000),
+                       ::testing::Values(-1, 0, 1, 7, 400, 2000)));
@@ -0,0 +1,143 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_parallel.hpp>
+
+#include "common_test_utils/perf_test_utils.hpp"
+#include "nodes/common/cpu_convert.h"
+#include "precision_data_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUUnitTestUtils;
+using MKLDNNPlugin::bfloat16_t;
+
+namespace {
+
+std::vector<uint8_t> makeConvertData(Precision prc, size_t size) {
+    return CPUUnitTestUtils::makeData(prc, size, [](size_t i) -> double {
+        // fractional values of both signs, some of them are out of the range of any 8/16-bit type
+        double value = (static_cast<double>((i * 7919) % 4001) - 2000.0) * 0.37;
+        if (i % 5 == 0)
+            value *= 1.e5;
+        return value;
+    });
+}
+
+// the implementation before the vectorized kernels
+template <typename srcType, typename dstType>
+void staticCastConvert(const uint8_t* srcPtr, uint8_t* dstPtr, size_t size) {
+    const auto src = reinterpret_cast<const srcType*>(srcPtr);
+    const auto dst = reinterpret_cast<dstType*>(dstPtr);
+    parallel_for(size, [&](size_t i) {
+        dst[i] = static_cast<dstType>(src[i]);
+    });
+}
+
+const std::vector<Precision> precisions = {
+    Precision::U8, Precision::I8, Precision::U16, Precision::I16,
+    Precision::I32, Precision::FP32, Precision::BF16, Precision::FP16
+};
+
+}  // namespace
+
+using CpuConvertParams = std::tuple<Precision, Precision, size_t>;
+
+class CpuConvertTest : public ::testing::TestWithParam<CpuConvertParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<CpuConvertParams>& obj) {
+        return std::string(std::get<0>(obj.param).name()) + "_to_" + std::get<1>(obj.param).name() +
+               "_size" + std::to_string(std::get<2>(obj.param));
+    }
+};
+
+TEST_P(CpuConvertTest, MatchesReference) {
+    Precision srcPrc, dstPrc;
+    size_t size;
+    std::tie(srcPrc, dstPrc, size) = GetParam();
+
+    const auto src = makeConvertData(srcPrc, size);
+    std::vector<uint8_t> ref(size * dstPrc.size());
+    for (size_t i = 0; i < size; i++)
+        writeValue(readValue(src.data(), srcPrc, i), ref.data(), dstPrc, i);
+
+    std::vector<uint8_t> dst(size * dstPrc.size());
+    cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(0, std::memcmp(ref.data() + i * dstPrc.size(), dst.data() + i * dstPrc.size(), dstPrc.size()))
+            << "element " << i << ": " << readValue(src.data(), srcPrc, i) << " is converted to "
+            << readValue(dst.data(), dstPrc, i) << " instead of " << readValue(ref.data(), dstPrc, i);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CpuConvert, CpuConvertTest,
+    ::testing::Combine(::testing::ValuesIn(precisions),
+                       ::testing::ValuesIn(precisions),
+                       // scalar tail, single vector, unrolled loop + tails, several parallel blocks
+                       ::testing::Values(1, 7, 16, 133, 50001)),
+    CpuConvertTest::getTestCaseName);
+
+TEST(CpuConvertTest, SaturatesFloatToInteger) {
+    const std::vector<float> src = {-1.e10f, -129.9f, -1.5f, -0.5f, 0.5f, 1.5f, 254.9f, 300.f, 2147483648.f, 1.e10f,
+                                    std::numeric_limits<float>::quiet_NaN()};
+    std::vector<uint8_t> u8(src.size());
+    std::vector<int32_t> i32(src.size());
+
+    cpu_convert(src.data(), u8.data(), Precision::FP32, Precision::U8, src.size());
+    cpu_convert(src.data(), i32.data(), Precision::FP32, Precision::I32, src.size());
+
+    ASSERT_EQ(std::vector<uint8_t>({0, 0, 0, 0, 0, 1, 254, 255, 255, 255, 0}), u8);
+    const auto i32min = std::numeric_limits<int32_t>::min(), i32max = std::numeric_limits<int32_t>::max();
+    ASSERT_EQ(std::vector<int32_t>({i32min, -129, -1, 0, 0, 1, 254, 300, i32max, i32max, i32min}), i32);
+}
+
+// Measures the bandwidth of cpu_convert against the per-element static_cast loop (the previous implementation),
+// the values are reported as the test properties
+TEST(CpuConvertBenchmark, DISABLED_bandwidth) {
+    const size_t size = 16 * 1024 * 1024;
+    const int iterations = 10;
+    using Baseline = std::function<void(const uint8_t*, uint8_t*, size_t)>;
+    const std::vector<std::tuple<Precision, Precision, Baseline>> pairs = {
+        std::make_tuple(Precision::FP32, Precision::BF16, staticCastConvert<float, bfloat16_t>),
+        std::make_tuple(Precision::BF16, Precision::FP32, staticCastConvert<bfloat16_t, float>),
+        std::make_tuple(Precision::FP32, Precision::FP16, staticCastConvert<float, ngraph::float16>),
+        std::make_tuple(Precision::FP16, Precision::FP32, staticCastConvert<ngraph::float16, float>),
+        std::make_tuple(Precision::FP32, Precision::U8, staticCastConvert<float, uint8_t>),
+        std::make_tuple(Precision::U8, Precision::FP32, staticCastConvert<uint8_t, float>),
+        std::make_tuple(Precision::FP32, Precision::I8, staticCastConvert<float, int8_t>),
+        std::make_tuple(Precision::I8, Precision::FP32, staticCastConvert<int8_t, float>),
+        std::make_tuple(Precision::FP32, Precision::I32, staticCastConvert<float, int32_t>),
+        std::make_tuple(Precision::I32, Precision::FP32, staticCastConvert<int32_t, float>),
+        std::make_tuple(Precision::I32, Precision::U8, staticCastConvert<int32_t, uint8_t>),
+        std::make_tuple(Precision::U8, Precision::I32, staticCastConvert<uint8_t, int32_t>),
+    };
+
+    for (const auto& pair : pairs) {
+        Precision srcPrc, dstPrc;
+        Baseline baseline;
+        std::tie(srcPrc, dstPrc, baseline) = pair;
+        const auto src = makeConvertData(srcPrc, size);
+        std::vector<uint8_t> dst(size * dstPrc.size());
+        const size_t bytes = size * (srcPrc.size() + dstPrc.size());
+
+        const double optimizedMs = CommonTestUtils::measureAverageMs([&]() {
+            cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+        }, iterations);
+        const double baselineMs = CommonTestUtils::measureAverageMs([&]() {
+            baseline(src.data(), dst.data(), size);
+        }, iterations);
+
+        const std::string name = std::string(srcPrc.name()) + "_to_" + dstPrc.name();
+        CommonTestUtils::reportPerfValue(name + "_gb_per_s", bytes / optimizedMs / 1.e6);
+        CommonTestUtils::reportPerfValue(name + "_static_cast_gb_per_s", bytes / baselineMs / 1.e6);
+    }
+}
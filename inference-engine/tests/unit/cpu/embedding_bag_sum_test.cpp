@@ -0,0 +1,133 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ngraph/runtime/reference/embedding_bag_offsets_sum.hpp>
+
+#include "nodes/embedding_bag_sum_imp.hpp"
+#include "precision_data_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
+using namespace CPUUnitTestUtils;
+
+namespace {
+
+// small values for the wide types, so the sums are exact, and the full range for the 8-bit ones, so the sums wrap around
+std::vector<uint8_t> makeEmbBagData(Precision prc, size_t size, std::mt19937& gen) {
+    int lowest = -3, max = 3;
+    if (prc == Precision::I8) {
+        lowest = std::numeric_limits<int8_t>::lowest();
+        max = std::numeric_limits<int8_t>::max();
+    } else if (prc == Precision::U8) {
+        lowest = 0;
+        max = std::numeric_limits<uint8_t>::max();
+    }
+    std::uniform_int_distribution<int> distribution(lowest, max);
+    return makeData(prc, size, [&](size_t) -> double { return distribution(gen); });
+}
+
+template <typename T>
+std::vector<uint8_t> referenceSum(const std::vector<uint8_t>& table, const uint8_t* weights, const std::vector<int>& indices,
+                                  const std::vector<int>& offsets, size_t depth) {
+    std::vector<uint8_t> dst(offsets.size() * depth * sizeof(T));
+    ngraph::runtime::reference::embeddingBagOffsetsSum<T, int>(reinterpret_cast<const T*>(table.data()), indices.data(),
+                                                               offsets.data(), nullptr, reinterpret_cast<const T*>(weights),
+                                                               reinterpret_cast<T*>(dst.data()), indices.size(),
+                                                               ngraph::Shape{offsets.size(), depth});
+    return dst;
+}
+
+}  // namespace
+
+// precision, depth, weighted
+using EmbBagSumParams = std::tuple<Precision, size_t, bool>;
+
+class EmbBagSumTest : public ::testing::TestWithParam<EmbBagSumParams> {};
+
+TEST_P(EmbBagSumTest, MatchesReference) {
+    Precision prc;
+    size_t depth;
+    bool weighted;
+    std::tie(prc, depth, weighted) = GetParam();
+
+    const int tableRows = 50;
+    std::mt19937 gen(static_cast<unsigned>(depth));
+    const auto table = makeEmbBagData(prc, tableRows * depth, gen);
+
+    // skewed bag sizes including the empty bags
+    std::vector<size_t> bagSizes = {0, 1, 3, 40, 0, 7, 2, 100, 1};
+    std::vector<int> indices;
+    for (auto size : bagSizes) {
+        std::uniform_int_distribution<int> row(0, tableRows - 1);
+        for (size_t i = 0; i < size; i++)
+            indices.push_back(row(gen));
+    }
+    const auto weights = makeEmbBagData(prc, indices.size(), gen);
+
+    std::vector<emb_bag> bags;
+    size_t offset = 0;
+    for (auto size : bagSizes) {
+        bags.push_back({size ? &indices[offset] : nullptr, size, weighted ? static_cast<int>(offset) : -1});
+        offset += size;
+    }
+
+    std::vector<uint8_t> dst(bags.size() * depth * prc.size());
+    XARCH::emb_bag_sum(table.data(), weighted ? weights.data() : nullptr, bags.data(), bags.size(), dst.data(), {prc, depth});
+
+    std::vector<int> offsets;
+    offset = 0;
+    for (auto size : bagSizes) {
+        offsets.push_back(static_cast<int>(offset));
+        offset += size;
+    }
+    const uint8_t* refWeights = weighted ? weights.data() : nullptr;
+
+    std::vector<uint8_t> expected;
+    switch (prc) {
+        case Precision::FP32:
+            expected = referenceSum<float>(table, refWeights, indices, offsets, depth);
+            break;
+        case Precision::I32:
+            expected = referenceSum<int32_t>(table, refWeights, indices, offsets, depth);
+            break;
+        case Precision::I8:
+            expected = referenceSum<int8_t>(table, refWeights, indices, offsets, depth);
+            break;
+        case Precision::U8:
+            expected = referenceSum<uint8_t>(table, refWeights, indices, offsets, depth);
+            break;
+        default:
+            // the reference sums BF16 in BF16, the kernel accumulates in FP32, so the small sums are compared exactly
+            expected.resize(dst.size());
+            for (size_t b = 0; b < bags.size(); b++) {
+                for (size_t j = 0; j < depth; j++) {
+                    double sum = 0.;
+                    for (size_t i = 0; i < bagSizes[b]; i++) {
+                        const double value = readValue(table.data(), prc, indices[offsets[b] + i] * depth + j);
+                        sum += weighted ? value * readValue(weights.data(), prc, offsets[b] + i) : value;
+                    }
+                    writeValue(sum, expected.data(), prc, b * depth + j);
+                }
+            }
+    }
+
+    for (size_t b = 0; b < bags.size(); b++) {
+        for (size_t j = 0; j < depth; j++) {
+            ASSERT_EQ(readValue(expected.data(), prc, b * depth + j), readValue(dst.data(), prc, b * depth + j))
+                << "bag " << b << ", element " << j;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(EmbBagSum, EmbBagSumTest,
+    ::testing::Combine(::testing::Values(Precision::FP32, Precision::BF16, Precision::I32, Precision::I8, Precision::U8),
+                       ::testing::Values(1, 13, 64, 300),
+                       ::testing::Bool()));
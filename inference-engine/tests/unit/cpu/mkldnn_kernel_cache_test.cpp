@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_kernel_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+struct Kernel {
+    explicit Kernel(int id) : id(id) {}
+    int id;
+};
+
+MKLDNNKernelKey makeKey(int value) {
+    MKLDNNKernelKey key("test");
+    key << value;
+    return key;
+}
+
+}  // namespace
+
+TEST(KernelCacheTest, SameKeyGivesSameKernel) {
+    MKLDNNKernelCache cache;
+    int created = 0;
+    auto create = [&] { return std::make_shared<Kernel>(created++); };
+
+    auto kernel = cache.getOrCreate<Kernel>(makeKey(1), create);
+    ASSERT_EQ(kernel, cache.getOrCreate<Kernel>(makeKey(1), create));
+    ASSERT_NE(kernel, cache.getOrCreate<Kernel>(makeKey(2), create));
+    ASSERT_EQ(2, created);
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(1, statistics.hits);
+    ASSERT_EQ(2, statistics.misses);
+    ASSERT_EQ(2, statistics.size);
+}
+
+TEST(KernelCacheTest, KeysDifferInScalars) {
+    MKLDNNKernelKey key1("test"), key2("test");
+    key1 << 0.1f << 1;
+    key2 << 0.100000001f << 1;
+    ASSERT_EQ(key1.str(), key2.str());
+
+    MKLDNNKernelKey key3("test");
+    key3 << 0.10000001f << 1;
+    ASSERT_NE(key1.str(), key3.str());
+
+    MKLDNNKernelKey key4("test");
+    key4 << 1 << 1;
+    MKLDNNKernelKey key5("test");
+    key5 << 11;
+    ASSERT_NE(key4.str(), key5.str());
+}
+
+TEST(KernelCacheTest, LeastRecentlyUsedIsEvicted) {
+    MKLDNNKernelCache cache(2);
+    int created = 0;
+    auto create = [&] { return std::make_shared<Kernel>(created++); };
+
+    auto kernel1 = cache.getOrCreate<Kernel>(makeKey(1), create);
+    cache.getOrCreate<Kernel>(makeKey(2), create);
+    // the first kernel becomes the most recently used one
+    cache.getOrCreate<Kernel>(makeKey(1), create);
+    cache.getOrCreate<Kernel>(makeKey(3), create);
+    ASSERT_EQ(3, created);
+    ASSERT_EQ(1, cache.getStatistics().evictions);
+
+    ASSERT_EQ(kernel1, cache.getOrCreate<Kernel>(makeKey(1), create));
+    cache.getOrCreate<Kernel>(makeKey(2), create);
+    ASSERT_EQ(4, created);
+
+    cache.setCapacity(1);
+    ASSERT_EQ(1, cache.getStatistics().size);
+    cache.clear();
+    ASSERT_EQ(0, cache.getStatistics().size);
+    // the evicted kernel stays alive while it is used
+    ASSERT_EQ(0, kernel1->id);
+}
+
+TEST(KernelCacheTest, ZeroCapacityDisablesCache) {
+    MKLDNNKernelCache cache(0);
+    int created = 0;
+    auto create = [&] { return std::make_shared<Kernel>(created++); };
+
+    auto kernel = cache.getOrCreate<Kernel>(makeKey(1), create);
+    ASSERT_NE(kernel, cache.getOrCreate<Kernel>(makeKey(1), create));
+    ASSERT_EQ(2, created);
+    ASSERT_EQ(0, cache.getStatistics().size);
+}
+
+TEST(KernelCacheTest, ConcurrentRequestsGetOneKernel) {
+    MKLDNNKernelCache cache;
+    std::atomic<int> created{0};
+    auto create = [&] { return std::make_shared<Kernel>(created++); };
+
+    std::vector<std::shared_ptr<Kernel>> kernels(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < kernels.size(); i++) {
+        threads.emplace_back([&, i] {
+            kernels[i] = cache.getOrCreate<Kernel>(makeKey(1), create);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& kernel : kernels)
+        ASSERT_EQ(kernels[0], kernel);
+    ASSERT_EQ(1, cache.getStatistics().size);
+}
+
+TEST(KernelCacheTest, ProcessWideCacheIsShared) {
+    ASSERT_EQ(MKLDNNKernelCache::get(), MKLDNNKernelCache::get());
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_memory_pool.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(MemoryPoolTest, SizeClasses) {
+    ASSERT_EQ(64, MKLDNNMemoryPool::sizeClass(1));
+    ASSERT_EQ(64, MKLDNNMemoryPool::sizeClass(64));
+    ASSERT_EQ(80, MKLDNNMemoryPool::sizeClass(65));
+    ASSERT_EQ(1280, MKLDNNMemoryPool::sizeClass(1025));
+    ASSERT_EQ(MKLDNNMemoryPool::kHugePageSize, MKLDNNMemoryPool::sizeClass(MKLDNNMemoryPool::kHugePageSize - 1));
+    ASSERT_EQ(2 * MKLDNNMemoryPool::kHugePageSize, MKLDNNMemoryPool::sizeClass(MKLDNNMemoryPool::kHugePageSize + 1));
+
+    for (size_t size = 1; size < 100000; size += 37) {
+        const size_t blockSize = MKLDNNMemoryPool::sizeClass(size);
+        ASSERT_GE(blockSize, size);
+        ASSERT_LE(blockSize, size + size / 4 + MKLDNNMemoryPool::kAlignment);
+    }
+}
+
+TEST(MemoryPoolTest, FreedBlocksAreReused) {
+    for (auto hugePages : {MKLDNNMemoryPool::HugePages::None, MKLDNNMemoryPool::HugePages::Transparent,
+                           MKLDNNMemoryPool::HugePages::Explicit}) {
+        MKLDNNMemoryPool pool(hugePages);
+        for (size_t size : {size_t(100), size_t(5000), 3 * MKLDNNMemoryPool::kHugePageSize + 10}) {
+            auto ptr = static_cast<uint8_t*>(pool.alloc(size));
+            ASSERT_NE(nullptr, ptr);
+            ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % MKLDNNMemoryPool::kAlignment);
+            std::memset(ptr, 1, size);
+            ASSERT_TRUE(pool.free(ptr));
+
+            // the same size class gets the freed block
+            auto reused = pool.alloc(MKLDNNMemoryPool::sizeClass(size));
+            ASSERT_EQ(ptr, reused);
+            ASSERT_TRUE(pool.free(reused));
+        }
+        const auto statistics = pool.getStatistics();
+        ASSERT_EQ(6, statistics.allocations);
+        ASSERT_EQ(3, statistics.reused);
+        ASSERT_EQ(0, statistics.usedBytes);
+
+        pool.release();
+        ASSERT_EQ(0, pool.getStatistics().cachedBytes);
+        ASSERT_EQ(0, pool.getStatistics().hugePageBytes);
+    }
+}
+
+TEST(MemoryPoolTest, CachedBytesAreBounded) {
+    MKLDNNMemoryPool pool(MKLDNNMemoryPool::HugePages::None, 1000);
+    std::vector<void*> blocks;
+    for (int i = 0; i < 20; i++)
+        blocks.push_back(pool.alloc(256));
+    ASSERT_EQ(20 * 256, pool.getStatistics().usedBytes);
+
+    for (auto block : blocks)
+        ASSERT_TRUE(pool.free(block));
+    ASSERT_EQ(768, pool.getStatistics().cachedBytes);
+    ASSERT_EQ(0, pool.getStatistics().usedBytes);
+}
+
+TEST(MemoryPoolTest, UnknownHandleIsNotFreed) {
+    MKLDNNMemoryPool pool(MKLDNNMemoryPool::HugePages::None);
+    int value = 0;
+    ASSERT_FALSE(pool.free(&value));
+}
+
+TEST(MemoryPoolTest, ProcessWidePoolsArePerNumaNode) {
+    auto pool = MKLDNNMemoryPool::get(0, MKLDNNMemoryPool::HugePages::Transparent);
+    ASSERT_EQ(pool, MKLDNNMemoryPool::get(0, MKLDNNMemoryPool::HugePages::Transparent));
+    ASSERT_NE(pool, MKLDNNMemoryPool::get(1, MKLDNNMemoryPool::HugePages::Transparent));
+    ASSERT_NE(pool, MKLDNNMemoryPool::get(0, MKLDNNMemoryPool::HugePages::None));
+    ASSERT_EQ(MKLDNNMemoryPool::get(-1, MKLDNNMemoryPool::HugePages::None), MKLDNNMemoryPool::get(-5, MKLDNNMemoryPool::HugePages::None));
+}
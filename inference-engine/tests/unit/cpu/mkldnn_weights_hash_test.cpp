@@ -0,0 +1,70 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+
+using MKLDNNPlugin::SimpleDataHash;
+
+TEST(WeightsHashTest, MatchesReferenceXXHash64) {
+    SimpleDataHash hashFunc;
+    const unsigned char abc[] = {'a', 'b', 'c'};
+
+    ASSERT_EQ(0xef46db3751d8e999ULL, hashFunc.hash(abc, 0));
+    ASSERT_EQ(0x44bc2cf5ad770999ULL, hashFunc.hash(abc, 3));
+}
+
+TEST(WeightsHashTest, IsDeterministicForChunkedData) {
+    SimpleDataHash hashFunc;
+    std::vector<unsigned char> data(3 * SimpleDataHash::kChunkSize + 17);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<unsigned char>(i * 31 + 7);
+
+    const auto ref = hashFunc.hash(data.data(), data.size());
+    for (int i = 0; i < 10; i++)
+        ASSERT_EQ(ref, hashFunc.hash(data.data(), data.size()));
+}
+
+TEST(WeightsHashTest, DependsOnEveryChunk) {
+    SimpleDataHash hashFunc;
+    std::vector<unsigned char> data(4 * SimpleDataHash::kChunkSize);
+    const auto ref = hashFunc.hash(data.data(), data.size());
+
+    for (size_t chunk = 0; chunk < 4; chunk++) {
+        auto modified = data;
+        modified[chunk * SimpleDataHash::kChunkSize + 5] = 1;
+        ASSERT_NE(ref, hashFunc.hash(modified.data(), modified.size()));
+    }
+
+    // the same data of different size
+    ASSERT_NE(ref, hashFunc.hash(data.data(), data.size() - 1));
+}
+
+namespace {
+
+class WeightsSharingSize : public MKLDNNPlugin::MKLDNNWeightsSharing {
+public:
+    size_t size() const {
+        return sharedWeights.size();
+    }
+};
+
+}  // namespace
+
+TEST(WeightsSharingTest, RemovesReleasedMemory) {
+    const mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    WeightsSharingSize cache;
+    auto kept = static_cast<MKLDNNPlugin::MKLDNNMemoryPtr>(
+        *cache.findOrCreate("kept", [&] { return std::make_shared<MKLDNNPlugin::MKLDNNMemory>(eng); }));
+
+    // the memory of every key is released at once as by the graphs of the evicted shapes
+    for (int i = 0; i < 1000; i++)
+        cache.findOrCreate("released" + std::to_string(i), [&] { return std::make_shared<MKLDNNPlugin::MKLDNNMemory>(eng); });
+
+    ASSERT_LE(cache.size(), 16u);
+    ASSERT_EQ(kept, static_cast<MKLDNNPlugin::MKLDNNMemoryPtr>(*cache.get("kept")));
+}
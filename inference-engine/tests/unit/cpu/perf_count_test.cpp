@@ -0,0 +1,118 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "perf_count.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(PerfHistogramTest, EmptyHistogram) {
+    PerfHistogram histogram;
+    ASSERT_EQ(0, histogram.count());
+    ASSERT_EQ(0, histogram.min());
+    ASSERT_EQ(0, histogram.max());
+    ASSERT_EQ(0, histogram.percentile(99));
+}
+
+TEST(PerfHistogramTest, Percentiles) {
+    PerfHistogram histogram;
+    for (uint64_t ns = 1; ns <= 1000; ns++)
+        histogram.record(ns * 1000);
+
+    ASSERT_EQ(1000, histogram.count());
+    ASSERT_EQ(1000, histogram.min());
+    ASSERT_EQ(1000000, histogram.max());
+    ASSERT_EQ(500500, histogram.avg());
+    for (double percent : {1.0, 50.0, 90.0, 99.0, 99.9}) {
+        const double expected = percent * 10000;
+        const double actual = static_cast<double>(histogram.percentile(percent));
+        ASSERT_GE(actual, expected);
+        ASSERT_LE(actual, expected * (1.0 + 1.0 / 16));
+    }
+    ASSERT_EQ(1000000, histogram.percentile(100));
+}
+
+TEST(PerfHistogramTest, SmallAndHugeValues) {
+    PerfHistogram histogram;
+    for (uint64_t ns = 0; ns < 16; ns++)
+        histogram.record(ns);
+    histogram.record(uint64_t(1) << 60);
+    ASSERT_EQ(0, histogram.percentile(1));
+    ASSERT_EQ(8, histogram.percentile(50));
+    ASSERT_EQ(uint64_t(1) << 60, histogram.max());
+    ASSERT_LE(histogram.percentile(100), uint64_t(1) << 60);
+}
+
+TEST(PerfHistogramTest, Merge) {
+    PerfHistogram first, second;
+    first.record(100);
+    second.record(1000);
+    second.record(2000);
+    first.merge(second);
+    ASSERT_EQ(3, first.count());
+    ASSERT_EQ(100, first.min());
+    ASSERT_EQ(2000, first.max());
+    ASSERT_GE(first.percentile(30), 100);
+    ASSERT_LE(first.percentile(30), 100 + 100 / 16);
+}
+
+TEST(PerfDetailsTest, CountsPerThread) {
+    PerfDetails details;
+    details.record(100);
+    std::thread([&] { details.record(300); details.record(500); }).join();
+    details.record(200);
+
+    ASSERT_EQ(4, details.histogram.count());
+    ASSERT_EQ(2, details.threads.size());
+    ASSERT_EQ(std::this_thread::get_id(), details.threads[0].thread);
+    ASSERT_EQ(2, details.threads[0].num);
+    ASSERT_EQ(300, details.threads[0].total);
+    ASSERT_EQ(200, details.threads[0].maximum);
+    ASSERT_EQ(2, details.threads[1].num);
+    ASSERT_EQ(500, details.threads[1].maximum);
+
+    PerfDetails merged;
+    merged.record(1000);
+    merged.merge(details);
+    ASSERT_EQ(5, merged.histogram.count());
+    ASSERT_EQ(2, merged.threads.size());
+    ASSERT_EQ(3, merged.threads[0].num);
+    ASSERT_EQ(1000, merged.threads[0].maximum);
+}
+
+TEST(PerfCountTest, DetailsAreCollectedWhenEnabled) {
+    PerfCount counter;
+    { PerfHelper helper(counter); }
+    ASSERT_EQ(nullptr, counter.getDetails());
+
+    counter.enableDetails();
+    { PerfHelper helper(counter); }
+    { PerfHelper helper(counter); }
+    ASSERT_NE(nullptr, counter.getDetails());
+    ASSERT_EQ(2, counter.getDetails()->histogram.count());
+}
+
+TEST(PerfReportTest, JsonAndCsv) {
+    PerfReport report;
+    auto& node = report["conv \"1\";a"];
+    node.layerType = "Convolution";
+    node.execType = "jit_avx2_FP32";
+    node.details.record(1500);
+    node.details.record(2500);
+
+    const auto json = PerfReportToJson(report);
+    ASSERT_NE(std::string::npos, json.find("\"name\": \"conv \\\"1\\\";a\""));
+    ASSERT_NE(std::string::npos, json.find("\"count\": 2"));
+    ASSERT_NE(std::string::npos, json.find("\"min\": 1.500"));
+    ASSERT_NE(std::string::npos, json.find("\"max\": 2.500"));
+    ASSERT_NE(std::string::npos, json.find("\"avg\": 2.000"));
+
+    const auto csv = PerfReportToCsv(report);
+    ASSERT_EQ(0, csv.find("layerName;layerType;execType;thread;count;"));
+    ASSERT_NE(std::string::npos, csv.find("\"conv \"\"1\"\";a\";Convolution;jit_avx2_FP32;all;2;1.500;2.000;"));
+}
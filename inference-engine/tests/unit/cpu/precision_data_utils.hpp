@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <ie_common.h>
+#include <ie_precision.hpp>
+#include <ngraph/type/float16.hpp>
+
+#include "utils/bfloat16.hpp"
+
+namespace CPUUnitTestUtils {
+
+/**
+ * Reads the i-th element of the buffer of the precision
+ */
+inline double readValue(const uint8_t* data, InferenceEngine::Precision prc, size_t i) {
+    using InferenceEngine::Precision;
+    switch (prc) {
+        case Precision::U8: return reinterpret_cast<const uint8_t*>(data)[i];
+        case Precision::I8: return reinterpret_cast<const int8_t*>(data)[i];
+        case Precision::U16: return reinterpret_cast<const uint16_t*>(data)[i];
+        case Precision::I16: return reinterpret_cast<const int16_t*>(data)[i];
+        case Precision::I32: return reinterpret_cast<const int32_t*>(data)[i];
+        case Precision::FP32: return reinterpret_cast<const float*>(data)[i];
+        case Precision::BF16: return reinterpret_cast<const MKLDNNPlugin::bfloat16_t*>(data)[i];
+        case Precision::FP16: return reinterpret_cast<const ngraph::float16*>(data)[i];
+        default: IE_THROW() << "Unexpected precision " << prc;
+    }
+}
+
+template <typename T>
+void saturate(double value, uint8_t* data, size_t i) {
+    using limits = std::numeric_limits<T>;
+    T result;
+    if (std::isnan(value) || value <= limits::lowest())
+        result = limits::lowest();
+    else if (value >= limits::max())
+        result = limits::max();
+    else
+        result = static_cast<T>(value);
+    reinterpret_cast<T*>(data)[i] = result;
+}
+
+/**
+ * Writes the value as the i-th element of the buffer of the precision. The reference semantics of the conversion:
+ * truncation towards zero and saturation for integers, rounding to nearest even for floats
+ */
+inline void writeValue(double value, uint8_t* data, InferenceEngine::Precision prc, size_t i) {
+    using InferenceEngine::Precision;
+    switch (prc) {
+        case Precision::U8: saturate<uint8_t>(value, data, i); break;
+        case Precision::I8: saturate<int8_t>(value, data, i); break;
+        case Precision::U16: saturate<uint16_t>(value, data, i); break;
+        case Precision::I16: saturate<int16_t>(value, data, i); break;
+        case Precision::I32: saturate<int32_t>(value, data, i); break;
+        case Precision::FP32: reinterpret_cast<float*>(data)[i] = static_cast<float>(value); break;
+        case Precision::BF16:
+            reinterpret_cast<MKLDNNPlugin::bfloat16_t*>(data)[i] = MKLDNNPlugin::bfloat16_t(static_cast<float>(value));
+            break;
+        case Precision::FP16: reinterpret_cast<ngraph::float16*>(data)[i] = ngraph::float16(static_cast<float>(value)); break;
+        default: IE_THROW() << "Unexpected precision " << prc;
+    }
+}
+
+/**
+ * Buffer of the elements of the precision, the i-th element is the value(i) converted by writeValue()
+ */
+template <typename ValueGenerator>
+std::vector<uint8_t> makeData(InferenceEngine::Precision prc, size_t size, ValueGenerator value) {
+    std::vector<uint8_t> data(size * prc.size());
+    for (size_t i = 0; i < size; i++)
+        writeValue(value(i), data.data(), prc, i);
+    return data;
+}
+
+}  // namespace CPUUnitTestUtils
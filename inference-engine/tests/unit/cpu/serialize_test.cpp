@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "serialize.h"
+
+using namespace InferenceEngine;
+using MKLDNNPlugin::CNNNetworkSerializer;
+using MKLDNNPlugin::CNNNetworkDeserializer;
+
+class IRCacheTest : public ::testing::Test {
+protected:
+    static CNNNetwork makeNetwork() {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 2, 3, 4});
+        param->set_friendly_name("input");
+        auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+        relu->set_friendly_name("relu");
+        auto result = std::make_shared<ngraph::opset1::Result>(relu);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+    }
+
+    void SetUp() override {
+        CNNNetwork network = makeNetwork();
+        PreProcessInfo& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+        preProcess.init(2);
+        for (size_t c = 0; c < 2; c++) {
+            auto meanImage = make_shared_blob<float>({Precision::FP32, {3, 4}, Layout::HW});
+            meanImage->allocate();
+            for (size_t i = 0; i < meanImage->size(); i++)
+                meanImage->buffer().as<float*>()[i] = static_cast<float>(c * 100 + i);
+            preProcess.setMeanImageForChannel(meanImage, c);
+        }
+        preProcess.setVariant(MEAN_IMAGE);
+
+        std::stringstream stream;
+        CNNNetworkSerializer serializer(stream, true);
+        serializer << network;
+        cache = stream.str();
+    }
+
+    CNNNetwork importNetwork(const std::string& data, bool& isTransformed) const {
+        std::istringstream stream(data);
+        CNNNetworkDeserializer deserializer(stream, [](const std::string& model, const Blob::CPtr&) {
+            EXPECT_FALSE(model.empty());
+            return makeNetwork();
+        });
+        CNNNetwork network;
+        deserializer >> network;
+        isTransformed = deserializer.isTransformed();
+        return network;
+    }
+
+    std::string cache;
+};
+
+TEST_F(IRCacheTest, RestoresInputsInfo) {
+    bool isTransformed = false;
+    auto network = importNetwork(cache, isTransformed);
+    ASSERT_TRUE(isTransformed);
+
+    const PreProcessInfo& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+    ASSERT_EQ(MEAN_IMAGE, preProcess.getMeanVariant());
+    ASSERT_EQ(2u, preProcess.getNumberOfChannels());
+    for (size_t c = 0; c < 2; c++) {
+        const auto meanImage = preProcess[c]->meanData;
+        ASSERT_NE(nullptr, meanImage);
+        ASSERT_EQ(12u, meanImage->size());
+        for (size_t i = 0; i < meanImage->size(); i++)
+            ASSERT_EQ(static_cast<float>(c * 100 + i), meanImage->cbuffer().as<const float*>()[i]);
+    }
+}
+
+TEST_F(IRCacheTest, ThrowsOnTruncatedStream) {
+    bool isTransformed = false;
+    for (size_t size = 0; size < cache.size(); size++) {
+        ASSERT_THROW(importNetwork(cache.substr(0, size), isTransformed), NetworkNotRead) << "size " << size;
+    }
+}
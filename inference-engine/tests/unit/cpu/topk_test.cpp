@@ -0,0 +1,154 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <common_test_utils/perf_test_utils.hpp>
+
+#include "nodes/topk_imp.hpp"
+#include "precision_data_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
+using namespace CPUUnitTestUtils;
+
+namespace {
+
+// few distinct values, so there are many equal ones, including -0.0 and 0.0
+std::vector<uint8_t> makeTopKData(Precision prc, size_t size, std::mt19937& gen) {
+    std::uniform_int_distribution<int> distribution(prc == Precision::U8 ? 0 : -20, 20);
+    return makeData(prc, size, [&](size_t i) -> double {
+        const int value = distribution(gen);
+        if (prc == Precision::FP32 || prc == Precision::BF16)
+            return value == 0 && (i % 2) ? -0. : value / 8.;
+        return prc == Precision::I32 ? value * 100000000. : value;
+    });
+}
+
+void referenceTopK(const std::vector<uint8_t>& src, std::vector<uint8_t>& dstValues, std::vector<int>& dstIndices,
+                   const topk_conf& conf) {
+    const Precision prc(conf.precision);
+    const size_t elemSize = prc.size();
+    std::vector<int> order(conf.axis_dim);
+    std::vector<double> values(conf.axis_dim);
+    for (int b = 0; b < conf.before_num; b++) {
+        for (int a = 0; a < conf.after_num; a++) {
+            for (int i = 0; i < conf.axis_dim; i++) {
+                order[i] = i;
+                values[i] = readValue(src.data(), prc, (b * conf.axis_dim + i) * conf.after_num + a);
+            }
+            std::partial_sort(order.begin(), order.begin() + conf.top_k, order.end(), [&](int i, int j) {
+                const bool better = conf.mode_max ? values[i] > values[j] : values[i] < values[j];
+                return better || (values[i] == values[j] && i < j);
+            });
+            if (conf.sort_index)
+                std::sort(order.begin(), order.begin() + conf.top_k);
+
+            for (int j = 0; j < conf.top_k; j++) {
+                const size_t dstIdx = (b * conf.top_k + j) * conf.after_num + a;
+                const size_t srcIdx = (b * conf.axis_dim + order[j]) * conf.after_num + a;
+                std::memcpy(&dstValues[dstIdx * elemSize], &src[srcIdx * elemSize], elemSize);
+                dstIndices[dstIdx] = order[j];
+            }
+        }
+    }
+}
+
+}  // namespace
+
+// precision, {before_num, axis_dim, after_num}, top_k
+using TopKParams = std::tuple<Precision, std::vector<int>, int>;
+
+class TopKTest : public ::testing::TestWithParam<TopKParams> {};
+
+TEST_P(TopKTest, MatchesReference) {
+    Precision prc;
+    std::vector<int> shape;
+    int topK;
+    std::tie(prc, shape, topK) = GetParam();
+    topK = std::min(topK, shape[1]);
+
+    std::mt19937 gen(shape[1] * topK);
+    const auto src = makeTopKData(prc, shape[0] * shape[1] * shape[2], gen);
+    const size_t dstSize = shape[0] * topK * shape[2];
+
+    for (bool modeMax : {true, false}) {
+        for (bool sortIndex : {false, true}) {
+            const topk_conf conf = {prc, shape[0], shape[1], shape[2], topK, modeMax, sortIndex};
+            std::vector<uint8_t> refValues(dstSize * prc.size()), values(dstSize * prc.size());
+            std::vector<int> refIndices(dstSize), indices(dstSize);
+
+            referenceTopK(src, refValues, refIndices, conf);
+            XARCH::topk_exec(src.data(), values.data(), indices.data(), conf);
+
+            ASSERT_EQ(refIndices, indices) << "mode_max " << modeMax << ", sort_index " << sortIndex;
+            ASSERT_EQ(refValues, values) << "mode_max " << modeMax << ", sort_index " << sortIndex;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TopK, TopKTest,
+    ::testing::Combine(::testing::Values(Precision::FP32, Precision::BF16, Precision::I32, Precision::I8, Precision::U8),
+                       ::testing::Values(std::vector<int>{1, 1000, 1},
+                                         std::vector<int>{1, 5000, 3},
+                                         std::vector<int>{3, 50, 37},
+                                         std::vector<int>{2, 7, 16},
+                                         std::vector<int>{2, 300, 8},
+                                         std::vector<int>{5, 3, 2}),
+                       ::testing::Values(1, 5, 32, 33, 200)));
+
+TEST(TopKTest, OutputsAreOptional) {
+    const std::vector<float> src = {1.f, 3.f, 2.f, 3.f};
+    std::vector<float> values(2);
+    std::vector<int> indices(2);
+    const topk_conf conf = {Precision::FP32, 1, 4, 1, 2, true, false};
+
+    XARCH::topk_exec(reinterpret_cast<const uint8_t*>(src.data()), nullptr, indices.data(), conf);
+    ASSERT_EQ(std::vector<int>({1, 3}), indices);
+    XARCH::topk_exec(reinterpret_cast<const uint8_t*>(src.data()), reinterpret_cast<uint8_t*>(values.data()), nullptr, conf);
+    ASSERT_EQ(std::vector<float>({3.f, 3.f}), values);
+}
+
+// Measures topk_exec against std::partial_sort of every slice on the grid of top_k and the axis length,
+// the times in ms are reported as the test properties
+TEST(TopKBenchmark, DISABLED_grid) {
+    const int elements = 4 * 1024 * 1024;
+    const int iterations = 5;
+
+    std::mt19937 gen(0);
+    for (int afterNum : {1, 64}) {
+        for (int axisDim : {16, 256, 4096, 65536}) {
+            const int beforeNum = std::max(1, elements / (axisDim * afterNum));
+            const auto src = makeTopKData(Precision::FP32, beforeNum * axisDim * afterNum, gen);
+            for (int topK : {1, 8, 32, 256, 4096}) {
+                if (topK > axisDim)
+                    continue;
+                const topk_conf conf = {Precision::FP32, beforeNum, axisDim, afterNum, topK, true, false};
+                std::vector<uint8_t> values(beforeNum * topK * afterNum * sizeof(float));
+                std::vector<int> indices(beforeNum * topK * afterNum);
+                std::vector<uint8_t> refValues(values.size());
+                std::vector<int> refIndices(indices.size());
+
+                const double optimized = CommonTestUtils::measureAverageMs([&]() {
+                    XARCH::topk_exec(src.data(), values.data(), indices.data(), conf);
+                }, iterations);
+                const double baseline = CommonTestUtils::measureAverageMs([&]() {
+                    referenceTopK(src, refValues, refIndices, conf);
+                }, iterations);
+                ASSERT_EQ(refValues, values) << "axis " << axisDim << ", stride " << afterNum << ", k " << topK;
+
+                const auto name = "axis" + std::to_string(axisDim) + "_stride" + std::to_string(afterNum) +
+                                  "_k" + std::to_string(topK);
+                CommonTestUtils::reportPerfValue(name + "_topk_ms", optimized);
+                CommonTestUtils::reportPerfValue(name + "_partial_sort_ms", baseline);
+            }
+        }
+    }
+}
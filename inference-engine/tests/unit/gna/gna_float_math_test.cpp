@@ -0,0 +1,308 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "common_test_utils/perf_test_utils.hpp"
+#include "runtime/cnn.h"
+#include "runtime/floatmath.h"
+
+namespace {
+// The naive kernels of the software emulation before the blocked and parallel ones, every output is accumulated
+// in the order of k, the optimized kernels must keep this order to give the same results
+namespace reference {
+void sgemm(const CBLAS_TRANSPOSE TransA, const CBLAS_TRANSPOSE TransB, const int M, const int N, const int K,
+           const float alpha, const float *A, const int lda, const float *B, const int ldb,
+           const float beta, float *C, const int ldc) {
+    if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
+                for (int k = 0; k < K; k++) {
+                    sum += A[i * lda + k] * B[k * ldb + j];
+                }
+                C[i * ldc + j] = sum;
+            }
+        }
+    } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                float sum;
+                sum = beta * C[i * ldc + j];
+                for (int k = 0; k < K; k++) {
+                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
+                }
+                C[i * ldc + j] = sum;
+            }
+        }
+    } else {
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
+                for (int k = 0; k < K; k++) {
+                    sum += A[k * lda + i] * B[k * ldb + j];
+                }
+                C[i * ldc + j] = sum;
+            }
+        }
+    }
+}
+
+void sgemm_subset(const CBLAS_TRANSPOSE TransA, const CBLAS_TRANSPOSE TransB, const int M, const int N, const int K,
+                  const float alpha, const float *A, const int lda, const float *B, const int ldb,
+                  const float beta, float *C, const int ldc, const uint32_t *OutputList, const int L) {
+    if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
+        for (int l = 0; l < L; l++) {
+            int i = OutputList[l];
+            for (int j = 0; j < N; j++) {
+                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
+                for (int k = 0; k < K; k++) {
+                    sum += A[i * lda + k] * B[k * ldb + j];
+                }
+                C[l * ldc + j] = sum;
+            }
+        }
+    } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
+        for (int i = 0; i < M; i++) {
+            for (int l = 0; l < L; l++) {
+                float sum;
+                int j = OutputList[l];
+                sum = beta * C[i * ldc + l];
+                for (int k = 0; k < K; k++) {
+                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
+                }
+                C[i * ldc + l] = sum;
+            }
+        }
+    } else {
+        for (int l = 0; l < L; l++) {
+            int i = OutputList[l];
+            for (int j = 0; j < N; j++) {
+                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
+                for (int k = 0; k < K; k++) {
+                    sum += A[k * lda + i] * B[k * ldb + j];
+                }
+                C[l * ldc + j] = sum;
+            }
+        }
+    }
+}
+
+void sgemv_split(const uint32_t N, const uint32_t K1, const uint32_t K2, const float *A1, const float *A2,
+                 const float *X, const float *B, float *C) {
+    uint32_t num_columns = K1 + K2;
+    for (uint32_t i = 0; i < N; i++) {
+        float sum = B[i];
+        for (uint32_t j = 0; j < K1; j++) {
+            sum += A1[j] * X[i * num_columns + j];
+        }
+        for (uint32_t j = K1; j < num_columns; j++) {
+            sum += A2[j - K1] * X[i * num_columns + j];
+        }
+        C[i] = sum;
+    }
+}
+
+void conv1d(const float *inputs, const float *filters, const float *biases, const uint32_t num_filter_outputs,
+            const uint32_t num_inputs_band_stride, const uint32_t num_filters, const uint32_t num_filter_coefficients,
+            float *outputs) {
+    for (uint32_t j = 0; j < num_filter_outputs; j++) {
+        const float *ptr_in = inputs + j * num_inputs_band_stride;
+        for (uint32_t i = 0; i < num_filters; i++) {
+            const float *ptr_coef = filters + i * num_filter_coefficients;
+            float sum = biases[i];
+            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
+                sum += ptr_in[k] * ptr_coef[k];
+            }
+            outputs[j * num_filters + i] = sum;
+        }
+    }
+}
+}  // namespace reference
+
+// magnitudes from 2^-10 to 2^10 with both signs, so the rounding of the sums depends on the summation order
+std::vector<float> makeData(size_t size, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> mantissa(-1.f, 1.f);
+    std::uniform_int_distribution<int> exponent(-10, 10);
+    std::vector<float> data(size);
+    for (auto &value : data) {
+        value = std::ldexp(mantissa(generator), exponent(generator));
+    }
+    return data;
+}
+
+std::vector<uint32_t> toBits(const std::vector<float> &data) {
+    std::vector<uint32_t> bits(data.size());
+    std::memcpy(bits.data(), data.data(), data.size() * sizeof(float));
+    return bits;
+}
+
+// every other output row starting from the last one
+std::vector<uint32_t> makeOutputList(int size) {
+    std::vector<uint32_t> outputs;
+    for (int i = size - 1; i >= 0; i -= 2) {
+        outputs.push_back(i);
+    }
+    return outputs;
+}
+}  // namespace
+
+TEST(GNAFloatMathDataTest, sumsDependOnSummationOrder) {
+    auto A = makeData(1000, 1);
+    auto B = makeData(1000, 2);
+    float forward = 0, backward = 0;
+    for (size_t k = 0; k < A.size(); k++) {
+        forward += A[k] * B[k];
+        backward += A[A.size() - 1 - k] * B[B.size() - 1 - k];
+    }
+    ASSERT_NE(toBits({forward}), toBits({backward}));
+}
+
+using GNAFloatMathParams = std::tuple<std::vector<int>,                            // M, N, K
+                                      std::pair<CBLAS_TRANSPOSE, CBLAS_TRANSPOSE>,  // TransA, TransB
+                                      float>;                                       // beta
+
+class GNAFloatMathTest : public ::testing::TestWithParam<GNAFloatMathParams> {
+protected:
+    void SetUp() override {
+        const auto &shape = std::get<0>(GetParam());
+        M = shape[0];
+        N = shape[1];
+        K = shape[2];
+        std::tie(transA, transB) = std::get<1>(GetParam());
+        beta = std::get<2>(GetParam());
+        lda = transA == CblasNoTrans ? K : M;
+        A = makeData(M * K, 1);
+    }
+
+    int M, N, K, lda;
+    CBLAS_TRANSPOSE transA, transB;
+    float beta;
+    std::vector<float> A;
+};
+
+TEST_P(GNAFloatMathTest, sgemmMatchesReference) {
+    const int ldb = transB == CblasNoTrans ? N : K;
+    auto B = makeData(K * N, 2);
+    auto C = makeData(M * N, 3);
+    auto ref = C;
+
+    reference::sgemm(transA, transB, M, N, K, 1.0, A.data(), lda, B.data(), ldb, beta, ref.data(), N);
+    cblas_sgemm1(CblasRowMajor, transA, transB, M, N, K, 1.0, A.data(), lda, B.data(), ldb, beta, C.data(), N);
+    ASSERT_EQ(toBits(ref), toBits(C));
+}
+
+TEST_P(GNAFloatMathTest, sgemmSubsetMatchesReference) {
+    const int ldb = transB == CblasNoTrans ? N : K;
+    auto B = makeData(K * N, 4);
+    // the transposed B selects the rows of B, otherwise the rows of A
+    const auto outputs = makeOutputList(transB == CblasNoTrans ? M : N);
+    const int L = static_cast<int>(outputs.size());
+    const int rowsC = transB == CblasNoTrans ? L : M;
+    const int ldc = transB == CblasNoTrans ? N : L;
+    auto C = makeData(rowsC * ldc, 5);
+    auto ref = C;
+
+    reference::sgemm_subset(transA, transB, M, N, K, 1.0, A.data(), lda, B.data(), ldb, beta, ref.data(), ldc,
+                            outputs.data(), L);
+    cblas_sgemm_subset(CblasRowMajor, transA, transB, M, N, K, 1.0, A.data(), lda, B.data(), ldb, beta, C.data(), ldc,
+                       outputs.data(), L);
+    ASSERT_EQ(toBits(ref), toBits(C));
+}
+
+INSTANTIATE_TEST_SUITE_P(GNAFloatMath, GNAFloatMathTest,
+    ::testing::Combine(
+        ::testing::Values(std::vector<int>{1, 1, 1},
+                          std::vector<int>{33, 1, 70},
+                          std::vector<int>{16, 8, 24},
+                          std::vector<int>{7, 13, 5},
+                          std::vector<int>{5, 37, 100},
+                          std::vector<int>{64, 4, 440}),
+        ::testing::Values(std::make_pair(CblasNoTrans, CblasNoTrans),
+                          std::make_pair(CblasNoTrans, CblasTrans),
+                          std::make_pair(CblasTrans, CblasNoTrans)),
+        ::testing::Values(0.f, 1.f)));
+
+TEST(GNAFloatKernelsTest, sgemvSplitMatchesReference) {
+    for (auto shape : {std::vector<uint32_t>{1, 1, 0}, {17, 5, 9}, {64, 440, 64}}) {
+        const uint32_t N = shape[0], K1 = shape[1], K2 = shape[2];
+        auto A1 = makeData(K1, 1);
+        auto A2 = makeData(K2, 2);
+        auto X = makeData(N * (K1 + K2), 3);
+        auto B = makeData(N, 4);
+        std::vector<float> ref(N), C(N);
+
+        reference::sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), ref.data());
+        sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+        ASSERT_EQ(toBits(ref), toBits(C));
+    }
+}
+
+TEST(GNAFloatKernelsTest, convolution1DMatchesReference) {
+    const uint32_t featureMapRows = 40, featureMapColumns = 3, featureMaps = 2;
+    const uint32_t filterRows = 8, filters = 16;
+    const uint32_t coefficients = filterRows * featureMaps * featureMapColumns;
+    const uint32_t outputs = featureMapRows - filterRows + 1;
+    auto inputs = makeData(featureMapRows * featureMaps * featureMapColumns, 1);
+    auto weights = makeData(filters * coefficients, 2);
+    auto biases = makeData(filters, 3);
+    std::vector<float> ref(outputs * filters), result(outputs * filters);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_out = outputs * filters;
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = result.data();
+    component.original_layer_name = "conv1d";
+    component.op.conv1D.num_filters = filters;
+    component.op.conv1D.num_filter_rows = filterRows;
+    component.op.conv1D.num_filter_coefficients = coefficients;
+    component.op.conv1D.num_feature_maps = featureMaps;
+    component.op.conv1D.num_feature_map_rows = featureMapRows;
+    component.op.conv1D.num_feature_map_columns = featureMapColumns;
+    component.op.conv1D.ptr_filters = weights.data();
+    component.op.conv1D.ptr_biases = biases.data();
+
+    reference::conv1d(inputs.data(), weights.data(), biases.data(), outputs, featureMaps * featureMapColumns, filters,
+                      coefficients, ref.data());
+    CNNFilter32(&component);
+    ASSERT_EQ(toBits(ref), toBits(result));
+}
+
+// Affine layers of the speech_sample DNN acoustic models in the software emulation: 440 spliced input features,
+// 2048 hidden units and 3425 senone outputs, a few frames per batch. The time of the naive and the optimized kernels
+// and the speedup are reported as the test properties
+TEST(GNAFloatMathBenchmark, DISABLED_speech_dnn_affine) {
+    const int iterations = 20;
+    for (auto shape : {std::vector<int>{2048, 440}, {2048, 2048}, {3425, 2048}}) {
+        for (int frames : {1, 4, 8}) {
+            const int M = shape[0], K = shape[1], N = frames;
+            auto A = makeData(M * K, 1);
+            auto B = makeData(K * N, 2);
+            std::vector<float> C(M * N);
+
+            const auto naiveMs = CommonTestUtils::measureAverageMs([&]() {
+                reference::sgemm(CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, C.data(), N);
+            }, iterations);
+            const auto optimizedMs = CommonTestUtils::measureAverageMs([&]() {
+                cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0,
+                             C.data(), N);
+            }, iterations);
+
+            const auto name = "affine_" + std::to_string(K) + "x" + std::to_string(M) + "_frames_" + std::to_string(N);
+            CommonTestUtils::reportPerfValue(name + "_naive_ms", naiveMs);
+            CommonTestUtils::reportPerfValue(name + "_ms", optimizedMs);
+            CommonTestUtils::reportPerfValue(name + "_speedup", naiveMs / optimizedMs);
+        }
+    }
+}
@@ -349,6 +349,62 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto replaceAddConstant = [&](CNNNetwork& cnnNet, int8_t value) {
+        for (const auto& op : cnnNet.getFunction()->get_ops()) {
+            if (op->get_friendly_name() == "add_constant") {
+                auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {value});
+                constant->set_friendly_name("add_constant");
+                ngraph::replace_node(op, constant);
+                break;
+            }
+        }
+    };
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    replaceAddConstant(net2, 5);
+    auto net3 = createNetwork();
+    replaceAddConstant(net3, 5);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashOfConstantDataIsMemoized) {
+    auto net = createNetwork();
+    const auto hash = NetworkCompilationContext::computeHash(net, {});
+    std::shared_ptr<ngraph::opset6::Constant> addConstant;
+    for (const auto& op : net.getFunction()->get_ops()) {
+        if (op->get_friendly_name() == "add_constant")
+            addConstant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op);
+    }
+    ASSERT_NE(nullptr, addConstant);
+
+    // changing the constant data in place isn't supported, the hash memoized for the buffer is reused
+    *static_cast<int8_t*>(const_cast<void*>(addConstant->get_data_ptr())) += 1;
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(net, {}));
+
+    // the data is hashed again when the constant is replaced
+    const auto value = addConstant->cast_vector<int8_t>();
+    auto newConstant = ngraph::opset6::Constant::create(ngraph::element::i8, addConstant->get_shape(), value);
+    newConstant->set_friendly_name("add_constant");
+    ngraph::replace_node(addConstant, newConstant);
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(net, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentShapes) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    net2.reshape({{"Parameter", {6, 1, 2}}});
+    auto net3 = createNetwork();
+    net3.reshape({{"Parameter", {6, 1, 2}}});
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_system_conf.h>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+#include "common_test_utils/perf_test_utils.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+namespace {
+
+// The previous implementation of CPUStreamsExecutor: all the threads pop the tasks from a single queue
+// guarded by a mutex and a condition variable. It's the baseline of the dispatch benchmark
+class SingleQueueExecutor : public ITaskExecutor {
+public:
+    explicit SingleQueueExecutor(int numThreads) {
+        for (int i = 0; i < numThreads; ++i) {
+            _threads.emplace_back([this] {
+                for (bool stopped = false; !stopped;) {
+                    Task task;
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
+                        if (!_taskQueue.empty()) {
+                            task = std::move(_taskQueue.front());
+                            _taskQueue.pop();
+                        }
+                    }
+                    if (task) {
+                        task();
+                    }
+                }
+            });
+        }
+    }
+
+    ~SingleQueueExecutor() override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopped = true;
+        }
+        _queueCondVar.notify_all();
+        for (auto& thread : _threads) thread.join();
+    }
+
+    void run(Task task) override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.emplace(std::move(task));
+        }
+        _queueCondVar.notify_one();
+    }
+
+private:
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _queueCondVar;
+    std::queue<Task> _taskQueue;
+    bool _isStopped = false;
+};
+
+// Reports the tasks/sec and the percentiles of the latency from run() to the task start as the test properties
+void benchmarkDispatch(const std::string& name, const ITaskExecutor::Ptr& executor, int numProducers, int tasksPerProducer) {
+    using Clock = std::chrono::steady_clock;
+    std::vector<std::vector<double>> latencies(numProducers, std::vector<double>(tasksPerProducer));
+    std::atomic<int> done = {0};
+    const int numTasks = numProducers * tasksPerProducer;
+
+    auto start = Clock::now();
+    std::vector<std::thread> producers;
+    for (int p = 0; p < numProducers; ++p) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < tasksPerProducer; ++i) {
+                auto submitted = Clock::now();
+                auto& latency = latencies[p][i];
+                executor->run([&, submitted] {
+                    latency = std::chrono::duration<double, std::micro>(Clock::now() - submitted).count();
+                    ++done;
+                });
+            }
+        });
+    }
+    for (auto&& producer : producers) producer.join();
+    while (done != numTasks) std::this_thread::yield();
+    auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<double> all;
+    for (auto&& l : latencies) all.insert(all.end(), l.begin(), l.end());
+    std::sort(all.begin(), all.end());
+    auto percentile = [&] (double p) { return all[static_cast<size_t>(p * (all.size() - 1))]; };
+    CommonTestUtils::reportPerfValue(name + "_tasks_per_sec", numTasks / seconds);
+    CommonTestUtils::reportPerfValue(name + "_latency_p50_us", percentile(0.5));
+    CommonTestUtils::reportPerfValue(name + "_latency_p99_us", percentile(0.99));
+    CommonTestUtils::reportPerfValue(name + "_latency_p999_us", percentile(0.999));
+    CommonTestUtils::reportPerfValue(name + "_latency_max_us", all.back());
+}
+
+}  // namespace
+
+TEST(CPUStreamsExecutorBenchmark, DISABLED_dispatchThroughputAndLatency) {
+    const int streams = std::max(2, getNumberOfCPUCores());
+    const int producers = 4;
+    const int tasksPerProducer = 200000;
+
+    benchmarkDispatch("SingleQueueExecutor", std::make_shared<SingleQueueExecutor>(streams), producers, tasksPerProducer);
+    benchmarkDispatch("CPUStreamsExecutor", std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"BenchmarkCPUStreamsExecutor",
+                      streams, 1, IStreamsExecutor::ThreadBindingType::NONE}), producers, tasksPerProducer);
+}
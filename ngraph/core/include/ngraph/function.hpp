@@ -8,6 +8,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -123,6 +124,9 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the nodes in topological order. The order is kept by the function until
+        /// the inputs or control dependencies of its nodes, the results, sinks or parameters are
+        /// changed, so the repeated calls don't sort the unchanged function again.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -253,6 +257,9 @@ namespace ngraph
         /// function and registers them, otherwise checks all the Parameters are registered.
         void prerequirements(bool detect_variables, bool detect_parameters);
 
+        /// \brief Makes the next get_ordered_ops() call sort the nodes again
+        void invalidate_ordered_ops() { m_topology_version->increment(); }
+
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
         const std::string m_unique_name;
@@ -265,6 +272,14 @@ namespace ngraph
         SinkVector m_sinks;
         ParameterVector m_parameters;
         VariableVector m_variables;
+
+        // the nodes sorted by get_ordered_ops() and the topology version they were sorted at, the
+        // nodes are referenced weakly, so the function doesn't keep the removed nodes alive
+        std::shared_ptr<TopologyVersion> m_topology_version = std::make_shared<TopologyVersion>();
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<std::weak_ptr<Node>> m_ordered_ops;
+        mutable size_t m_ordered_ops_version = 0;
+        mutable bool m_ordered_ops_valid = false;
     };
 
     template <>
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -101,6 +102,19 @@ namespace ngraph
     /// Alias useful for cloning
     using NodeMap = std::unordered_map<ngraph::Node*, std::shared_ptr<ngraph::Node>>;
 
+    /// \brief Counter of the topology changes of a function. The nodes of the function increment
+    /// it when their inputs or control dependencies are changed, so the function keeps its
+    /// topologically sorted nodes until the counter is changed.
+    class NGRAPH_API TopologyVersion
+    {
+    public:
+        void increment() { ++m_version; }
+        size_t get() const { return m_version; }
+
+    private:
+        std::atomic<size_t> m_version{0};
+    };
+
     /// \brief Used in evaluator switch statement so that the case type and evaluate call
     /// are guaranteed to have the types match.
     ///
@@ -136,6 +150,9 @@ namespace ngraph
         template <typename NodeType>
         friend class Output;
 
+        // For access to the topology versions.
+        friend class Function;
+
     public:
         /// \brief Verifies that attributes and inputs are consistent and computes output shapes
         /// and element types. Must be implemented by concrete child classes so that it
@@ -493,6 +510,13 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// \brief Makes the changes of the node inputs and control dependencies increment
+        /// the version.
+        void add_topology_version(const std::shared_ptr<TopologyVersion>& version);
+        /// \brief Notifies the functions containing the node about the change of its inputs or
+        /// control dependencies.
+        void increment_topology_versions();
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
         std::string m_node_type;
@@ -502,6 +526,10 @@ namespace ngraph
         static std::atomic<size_t> m_next_instance_id;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
+        // versions of the functions which sorted the node, not copied by the copy constructor.
+        // A node may belong to several functions sorted concurrently, so the list has its own lock
+        std::vector<std::weak_ptr<TopologyVersion>> m_topology_versions;
+        mutable std::mutex m_topology_versions_mutex;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
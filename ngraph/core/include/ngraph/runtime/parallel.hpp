@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Runs body(ithr, nthr) for every ithr in [0, nthr) concurrently. The executor
+        /// chooses nthr, which is not greater than max_threads, and returns when all the calls are
+        /// finished.
+        using parallel_executor_t = std::function<void(
+            size_t max_threads, const std::function<void(size_t ithr, size_t nthr)>& body)>;
+
+        /// \brief Sets the executor of the parallel reference kernels, so the applications run
+        /// them on their own threads. The executor is process wide, the empty one makes the
+        /// loops sequential.
+        /// \return The previous executor, so the caller can restore it.
+        NGRAPH_API parallel_executor_t set_parallel_executor(parallel_executor_t executor);
+
+        /// \brief Splits [0, work_amount) into contiguous ranges of at least min_chunk items and
+        /// calls body(begin, end) for the ranges concurrently on the threads of the executor.
+        /// Without an executor, and for the loops started inside the body, the whole range runs
+        /// on the calling thread. The first exception thrown by the body is rethrown after all
+        /// the ranges are finished.
+        NGRAPH_API void parallel_for(size_t work_amount,
+                                     size_t min_chunk,
+                                     const std::function<void(size_t begin, size_t end)>& body);
+    } // namespace runtime
+} // namespace ngraph
@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
 #include <utility>
+#include <vector>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -83,6 +86,91 @@ namespace ngraph
                         --axis;
                     return axis;
                 }
+
+                // elements of the output per parallel chunk, the threads are started for the
+                // large tensors only
+                constexpr size_t parallel_min_elements = 64 * 1024;
+
+                // NUMPY broadcast computed by the rows of the innermost axis in parallel. The
+                // adjacent axes broadcasted the same way in both arguments are merged, so the
+                // rows are long for the per-channel broadcasts like {O, I, H, W} x {O, 1, 1, 1}.
+                template <typename T, typename U, typename Functor>
+                void parallel_numpy_autobroadcast_binop(const T* arg0,
+                                                        const T* arg1,
+                                                        U* out,
+                                                        const Shape& arg0_shape,
+                                                        const Shape& arg1_shape,
+                                                        const Shape& output_shape,
+                                                        Functor elementwise_functor)
+                {
+                    const size_t padding0 = output_shape.size() - arg0_shape.size();
+                    const size_t padding1 = output_shape.size() - arg1_shape.size();
+                    Shape dims;
+                    std::vector<bool> broadcasted0;
+                    std::vector<bool> broadcasted1;
+                    for (size_t i = 0; i < output_shape.size(); i++)
+                    {
+                        if (output_shape[i] == 1)
+                            continue;
+                        const bool b0 = value_with_padding_or(arg0_shape, padding0, i, 1) == 1;
+                        const bool b1 = value_with_padding_or(arg1_shape, padding1, i, 1) == 1;
+                        if (!dims.empty() && broadcasted0.back() == b0 && broadcasted1.back() == b1)
+                        {
+                            dims.back() *= output_shape[i];
+                        }
+                        else
+                        {
+                            dims.push_back(output_shape[i]);
+                            broadcasted0.push_back(b0);
+                            broadcasted1.push_back(b1);
+                        }
+                    }
+                    if (dims.empty())
+                    {
+                        out[0] = elementwise_functor(arg0[0], arg1[0]);
+                        return;
+                    }
+
+                    const size_t rank = dims.size();
+                    std::vector<size_t> strides0(rank);
+                    std::vector<size_t> strides1(rank);
+                    for (size_t i = rank, size0 = 1, size1 = 1; i-- > 0;)
+                    {
+                        strides0[i] = broadcasted0[i] ? 0 : size0;
+                        strides1[i] = broadcasted1[i] ? 0 : size1;
+                        size0 *= broadcasted0[i] ? 1 : dims[i];
+                        size1 *= broadcasted1[i] ? 1 : dims[i];
+                    }
+
+                    const size_t row_size = dims.back();
+                    const size_t inner_stride0 = strides0.back();
+                    const size_t inner_stride1 = strides1.back();
+                    runtime::parallel_for(
+                        shape_size(dims) / row_size,
+                        std::max<size_t>(1, parallel_min_elements / row_size),
+                        [&](size_t begin, size_t end) {
+                            for (size_t row = begin; row < end; ++row)
+                            {
+                                size_t offset0 = 0;
+                                size_t offset1 = 0;
+                                for (size_t i = rank - 1, index = row; i-- > 0;)
+                                {
+                                    const size_t coordinate = index % dims[i];
+                                    index /= dims[i];
+                                    offset0 += coordinate * strides0[i];
+                                    offset1 += coordinate * strides1[i];
+                                }
+                                const T* row0 = arg0 + offset0;
+                                const T* row1 = arg1 + offset1;
+                                U* row_out = out + row * row_size;
+                                for (size_t j = 0; j < row_size; ++j)
+                                {
+                                    row_out[j] = elementwise_functor(row0[j * inner_stride0],
+                                                                     row1[j * inner_stride1]);
+                                }
+                            }
+                        });
+                }
             } // namespace internal
 
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -114,10 +202,14 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    runtime::parallel_for(shape_size(arg0_shape),
+                                          internal::parallel_min_elements,
+                                          [&](size_t begin, size_t end) {
+                                              for (size_t i = begin; i < end; i++)
+                                              {
+                                                  out[i] = elementwise_functor(arg0[i], arg1[i]);
+                                              }
+                                          });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -173,6 +265,18 @@ namespace ngraph
                             if (dim0 != dim1)
                                 axis = std::max(axis, i);
                         }
+
+                        if (shape_size(output_shape) >= parallel_min_elements)
+                        {
+                            parallel_numpy_autobroadcast_binop(arg0,
+                                                               arg1,
+                                                               out,
+                                                               arg0_shape,
+                                                               arg1_shape,
+                                                               output_shape,
+                                                               elementwise_functor);
+                            break;
+                        }
 #if 0
                         // Universal function without optimisations
                         CoordinateTransformBasic arg0_transform(arg0_shape);
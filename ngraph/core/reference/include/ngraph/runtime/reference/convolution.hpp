@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cfenv>
 #include <cmath>
@@ -12,6 +13,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
@@ -33,6 +35,9 @@ namespace ngraph
                 constexpr size_t out_batch_axis = 0;
                 constexpr size_t out_channel_axis = 1;
                 constexpr size_t spatial_axis = 2;
+                // multiply-adds per parallel chunk, the threads are started for the large
+                // convolutions only
+                constexpr size_t min_work_per_chunk = 64 * 1024;
 
                 struct ConvolutionParams
                 {
@@ -279,17 +284,27 @@ namespace ngraph
                 const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
                 const size_t filter_size = shape_size(filter_shape);
 
-                auto batch = in;
-                for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx)
+                const size_t out_channels = batches_count * filters_count;
+                if (out_channels == 0)
                 {
-                    auto filter = f;
-                    for (size_t f_idx = 0; f_idx < filters_count; ++f_idx)
-                    {
-                        convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-                        filter += filter_size;
-                    }
-                    batch += batch_size;
+                    return;
                 }
+                const size_t out_channel_size = shape_size(out_shape) / out_channels;
+                // the output channels of all the batches are computed in parallel
+                const size_t channel_work = std::max<size_t>(1, out_channel_size * filter_size);
+                runtime::parallel_for(
+                    out_channels,
+                    std::max<size_t>(1, min_work_per_chunk / channel_work),
+                    [&](size_t begin, size_t end) {
+                        for (size_t channel = begin; channel < end; ++channel)
+                        {
+                            const T* batch = in + (channel / filters_count) * batch_size;
+                            const T* filter = f + (channel % filters_count) * filter_size;
+                            T* channel_out = out + channel * out_channel_size;
+                            convolve_3D_channels(
+                                params, batch, batch_shape, filter, filter_shape, channel_out);
+                        }
+                    });
             }
 
             // DEPRECATED, can't be removed currently due to kmb-plugin dependency (#47799)
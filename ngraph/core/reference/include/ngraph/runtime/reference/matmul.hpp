@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <utility>
 #include <vector>
 
+#include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/shape_util.hpp"
 
@@ -21,6 +24,89 @@ namespace ngraph
         {
             namespace details
             {
+                // multiply-adds per parallel chunk, the threads are started for the large
+                // matrices only
+                constexpr size_t dot_min_work_per_chunk = 64 * 1024;
+                // rows of the right operand kept in cache while they are applied to the rows of
+                // the output
+                constexpr size_t dot_k_block = 64;
+
+                // Computes the [row_begin, row_end) rows of the {I, K} x {K, J} product of the
+                // batch, the rows of all the batches are numbered consecutively
+                template <typename T>
+                void dot_rows(const T* arg0,
+                              const T* arg1,
+                              T* out,
+                              size_t I_dim,
+                              size_t K_dim,
+                              size_t J_dim,
+                              size_t arg0_batch_offset,
+                              size_t arg1_batch_offset,
+                              size_t row_begin,
+                              size_t row_end)
+                {
+                    std::fill(out + row_begin * J_dim, out + row_end * J_dim, T{0});
+                    // the products are added in the same order for every output element, so
+                    // the result doesn't depend on the blocking
+                    for (size_t k0 = 0; k0 < K_dim; k0 += dot_k_block)
+                    {
+                        const size_t k_end = std::min(K_dim, k0 + dot_k_block);
+                        for (size_t row = row_begin; row < row_end; ++row)
+                        {
+                            const size_t batch = row / I_dim;
+                            const size_t i = row % I_dim;
+                            const T* a = arg0 + batch * arg0_batch_offset + i * K_dim;
+                            const T* b = arg1 + batch * arg1_batch_offset;
+                            T* c = out + row * J_dim;
+                            for (size_t k = k0; k < k_end; ++k)
+                            {
+                                const T a_value = a[k];
+                                const T* b_row = b + k * J_dim;
+                                for (size_t j = 0; j < J_dim; ++j)
+                                {
+                                    c[j] += a_value * b_row[j];
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // The batched {I, K} x {K, J} product, the rows of the output are computed in
+                // parallel
+                template <typename T>
+                void batched_dot(const T* arg0,
+                                 const T* arg1,
+                                 T* out,
+                                 size_t batches,
+                                 size_t I_dim,
+                                 size_t K_dim,
+                                 size_t J_dim,
+                                 size_t arg0_batch_offset,
+                                 size_t arg1_batch_offset)
+                {
+                    const size_t rows = batches * I_dim;
+                    if (rows == 0 || J_dim == 0)
+                    {
+                        return;
+                    }
+                    const size_t row_work = std::max<size_t>(1, K_dim * J_dim);
+                    runtime::parallel_for(
+                        rows,
+                        std::max<size_t>(1, dot_min_work_per_chunk / row_work),
+                        [&](size_t row_begin, size_t row_end) {
+                            dot_rows(arg0,
+                                     arg1,
+                                     out,
+                                     I_dim,
+                                     K_dim,
+                                     J_dim,
+                                     arg0_batch_offset,
+                                     arg1_batch_offset,
+                                     row_begin,
+                                     row_end);
+                        });
+                }
+
                 template <typename T>
                 void dot(const T* arg0,
                          const T* arg1,
@@ -29,7 +115,6 @@ namespace ngraph
                          const Shape& arg1_shape,
                          const Shape& out_shape)
                 {
-                    std::fill(out, out + shape_size(out_shape), T{0});
                     const size_t arg0_rank = arg0_shape.size();
                     const size_t arg1_rank = arg1_shape.size();
 
@@ -41,19 +126,10 @@ namespace ngraph
                     const size_t K_dim =
                         arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
 
-                    for (size_t i = 0; i < I_dim; ++i)
-                    {
-                        for (size_t k = 0; k < K_dim; ++k)
-                        {
-                            const size_t a_idx = i * K_dim + k;
-                            for (size_t j = 0; j < J_dim; ++j)
-                            {
-                                const size_t b_idx = k * J_dim + j;
-                                const size_t out_idx = i * J_dim + j;
-                                out[out_idx] += arg0[a_idx] * arg1[b_idx];
-                            }
-                        }
-                    }
+                    NGRAPH_CHECK(I_dim * J_dim == shape_size(out_shape),
+                                 "Unexpected output shape of the dot: ",
+                                 out_shape);
+                    batched_dot(arg0, arg1, out, 1, I_dim, K_dim, J_dim, 0, 0);
                 }
 
                 std::vector<size_t> get_transpose_order(const Shape& input_shape);
@@ -235,15 +311,27 @@ namespace ngraph
                 const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
                 const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
                 const size_t output_offset = shape_size(dot_output_shape);
-                for (size_t i = 0; i < output_batch_size; i++)
-                {
-                    details::dot(arg0_data + i * arg0_offset,
-                                 arg1_data + i * arg1_offset,
-                                 out + i * output_offset,
-                                 dot_arg0_shape,
-                                 dot_arg1_shape,
-                                 dot_output_shape);
-                }
+                const size_t dot_arg0_rank = dot_arg0_shape.size();
+                const size_t dot_arg1_rank = dot_arg1_shape.size();
+                const size_t I_dim = dot_arg0_rank == 1 ? 1 : dot_arg0_shape[dot_arg0_rank - 2];
+                const size_t J_dim = dot_arg1_rank == 1 ? 1 : dot_arg1_shape[dot_arg1_rank - 1];
+                const size_t K_dim = dot_arg1_rank == 1 ? dot_arg1_shape[dot_arg1_rank - 1]
+                                                        : dot_arg1_shape[dot_arg1_rank - 2];
+                NGRAPH_CHECK(I_dim * J_dim == output_offset,
+                             "Unexpected output shape of the batched dot: ",
+                             dot_output_shape);
+
+                // the rows of all the batches are distributed between the threads, so both the
+                // large matrices and the large batches of the small ones are parallel
+                details::batched_dot(arg0_data,
+                                     arg1_data,
+                                     out,
+                                     output_batch_size,
+                                     I_dim,
+                                     K_dim,
+                                     J_dim,
+                                     arg0_offset,
+                                     arg1_offset);
             }
         } // namespace reference
     }     // namespace runtime
@@ -7,241 +7,263 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/shape_util.hpp"
 
 using namespace ngraph;
 
 namespace
 {
-    void reshape_in0(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    // elements copied by a parallel chunk, the threads are started for the large tensors only
+    constexpr size_t min_elements_per_chunk = 32 * 1024;
+    // side of the square tile, the reads and the writes of the tile stay in L1
+    constexpr size_t tile_size = 16;
+
+    bool no_axis_reordering(const AxisVector& axis_order)
     {
-        memcpy(out, in, elem_size);
+        auto tmp = axis_order;
+        std::sort(begin(tmp), end(tmp));
+        tmp.erase(std::unique(begin(tmp), end(tmp)), end(tmp));
+        return tmp == axis_order;
     }
 
-    void reshape_in1(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    // Drops the axes of size 1 and merges the input axes which stay adjacent in the output, so
+    // e.g. the NCHW -> NHWC transpose is done as the {N, C, H*W} -> {N, H*W, C} one.
+    void collapse_axes(const Shape& in_shape,
+                       const AxisVector& in_axis_order,
+                       Shape& shape,
+                       AxisVector& axis_order)
     {
-        size_t size[1];
-        size_t in_index[1];
-        size_t* map_index[1];
-        for (size_t i = 0; i < 1; i++)
+        std::vector<size_t> new_axis(in_shape.size());
+        size_t kept = 0;
+        for (size_t axis = 0; axis < in_shape.size(); ++axis)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            new_axis[axis] = kept;
+            if (in_shape[axis] != 1)
+            {
+                ++kept;
+            }
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+
+        // runs of the consecutive input axes in the output order
+        std::vector<std::pair<size_t, size_t>> runs;
+        for (auto axis : in_axis_order)
         {
-            memcpy(out, in + *map_index[0] * elem_size, elem_size);
-            out += elem_size;
+            if (in_shape[axis] == 1)
+            {
+                continue;
+            }
+            if (!runs.empty() && runs.back().second + 1 == new_axis[axis])
+            {
+                runs.back().second = new_axis[axis];
+            }
+            else
+            {
+                runs.emplace_back(new_axis[axis], new_axis[axis]);
+            }
         }
-    }
 
-    void reshape_in2(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[2];
-        size_t in_index[2];
-        size_t* map_index[2];
-        for (size_t i = 0; i < 2; i++)
+        std::vector<size_t> kept_dims;
+        for (auto dim : in_shape)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            if (dim != 1)
+            {
+                kept_dims.push_back(dim);
+            }
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+
+        auto sorted_runs = runs;
+        std::sort(sorted_runs.begin(), sorted_runs.end());
+        shape.clear();
+        for (const auto& run : sorted_runs)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            size_t dim = 1;
+            for (size_t axis = run.first; axis <= run.second; ++axis)
             {
-                // clang-format off
-                memcpy(out,
-                       in + (*map_index[0] * in_shape[1] +
-                             *map_index[1]) * elem_size,
-                       elem_size);
-                out += elem_size;
-                // clang-format on
+                dim *= kept_dims[axis];
             }
+            shape.push_back(dim);
+        }
+        axis_order.clear();
+        for (const auto& run : runs)
+        {
+            axis_order.push_back(
+                std::lower_bound(sorted_runs.begin(), sorted_runs.end(), run) -
+                sorted_runs.begin());
         }
     }
 
-    void reshape_in3(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    template <size_t N>
+    struct element
     {
-        size_t size[3];
-        size_t in_index[3];
-        size_t* map_index[3];
-        for (size_t i = 0; i < 3; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        char bytes[N];
+    };
+
+    // Copies the [rows x cols] block of the elements, rows are read with the stride of 1 and
+    // cols are written with the stride of 1
+    template <typename T>
+    void transpose_block(const char* in,
+                         char* out,
+                         size_t rows,
+                         size_t cols,
+                         size_t in_col_stride,
+                         size_t out_row_stride)
+    {
+        const T* src = reinterpret_cast<const T*>(in);
+        T* dst = reinterpret_cast<T*>(out);
+        for (size_t c0 = 0; c0 < cols; c0 += tile_size)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            const size_t c_end = std::min(cols, c0 + tile_size);
+            for (size_t r = 0; r < rows; ++r)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                for (size_t c = c0; c < c_end; ++c)
                 {
-                    // clang-format off
-                    memcpy(out,
-                           in + (*map_index[0] * in_shape[1] * in_shape[2] +
-                                 *map_index[1] * in_shape[2] +
-                                 *map_index[2]) * elem_size,
-                           elem_size);
-                    out += elem_size;
-                    // clang-format on
+                    dst[r * out_row_stride + c] = src[c * in_col_stride + r];
                 }
             }
         }
     }
 
-    void reshape_in4(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    void transpose_block_bytes(const char* in,
+                               char* out,
+                               size_t rows,
+                               size_t cols,
+                               size_t in_col_stride,
+                               size_t out_row_stride,
+                               size_t elem_size)
     {
-        size_t size[4];
-        size_t in_index[4];
-        size_t* map_index[4];
-        for (size_t i = 0; i < 4; i++)
+        for (size_t r = 0; r < rows; ++r)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            for (size_t c = 0; c < cols; ++c)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        // clang-format off
-                        memcpy(out,
-                               in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[2] * in_shape[3] +
-                                     *map_index[3]) * elem_size,
-                               elem_size);
-                        out += elem_size;
-                        // clang-format on
-                    }
-                }
+                std::memcpy(out + (r * out_row_stride + c) * elem_size,
+                            in + (c * in_col_stride + r) * elem_size,
+                            elem_size);
             }
         }
     }
 
-    void reshape_in5(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    void transpose_block(const char* in,
+                         char* out,
+                         size_t rows,
+                         size_t cols,
+                         size_t in_col_stride,
+                         size_t out_row_stride,
+                         size_t elem_size)
+    {
+        switch (elem_size)
+        {
+        case 1:
+            transpose_block<element<1>>(in, out, rows, cols, in_col_stride, out_row_stride);
+            break;
+        case 2:
+            transpose_block<element<2>>(in, out, rows, cols, in_col_stride, out_row_stride);
+            break;
+        case 4:
+            transpose_block<element<4>>(in, out, rows, cols, in_col_stride, out_row_stride);
+            break;
+        case 8:
+            transpose_block<element<8>>(in, out, rows, cols, in_col_stride, out_row_stride);
+            break;
+        default:
+            transpose_block_bytes(in, out, rows, cols, in_col_stride, out_row_stride, elem_size);
+            break;
+        }
+    }
+
+    // Blocked transpose of the collapsed shape. The output axis read with the stride of 1 and
+    // the innermost output axis form the 2D transposes of the tiles, the rest of the axes are
+    // the outer loop, so the tiles are distributed between the threads.
+    void transpose(const char* in,
+                   char* out,
+                   const Shape& shape,
+                   const AxisVector& axis_order,
+                   size_t elem_size)
     {
-        size_t size[5];
-        size_t in_index[5];
-        size_t* map_index[5];
-        for (size_t i = 0; i < 5; i++)
+        const size_t rank = shape.size();
+        const auto in_strides = row_major_strides(shape);
+        Shape out_dims(rank);
+        std::vector<size_t> src_strides(rank);
+        for (size_t i = 0; i < rank; ++i)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            out_dims[i] = shape[axis_order[i]];
+            src_strides[i] = in_strides[axis_order[i]];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        const auto dst_strides = row_major_strides(out_dims);
+
+        const size_t inner = std::find(axis_order.begin(), axis_order.end(), rank - 1) -
+                             axis_order.begin();
+        const size_t last = rank - 1;
+        if (inner == last)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+            // the innermost axis is kept, so the rows are copied as they are
+            const size_t row_size = out_dims[last] * elem_size;
+            runtime::parallel_for(
+                shape_size(out_dims) / out_dims[last],
+                std::max<size_t>(1, min_elements_per_chunk / out_dims[last]),
+                [&](size_t begin, size_t end) {
+                    for (size_t row = begin; row < end; ++row)
                     {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
+                        size_t outer = row;
+                        size_t src_offset = 0;
+                        for (size_t axis = last; axis-- > 0;)
                         {
-                            // clang-format off
-                            memcpy(out,
-                                   in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[3] * in_shape[4] +
-                                         *map_index[4]) * elem_size,
-                                   elem_size);
-                            out += elem_size;
-                            // clang-format on
+                            src_offset += (outer % out_dims[axis]) * src_strides[axis];
+                            outer /= out_dims[axis];
                         }
+                        std::memcpy(out + row * row_size, in + src_offset * elem_size, row_size);
                     }
-                }
-            }
+                });
+            return;
         }
-    }
 
-    void reshape_in6(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[6];
-        size_t in_index[6];
-        size_t* map_index[6];
-        for (size_t i = 0; i < 6; i++)
+        std::vector<size_t> outer_axes;
+        for (size_t i = 0; i < last; ++i)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            if (i != inner)
+            {
+                outer_axes.push_back(i);
+            }
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        size_t outer_count = 1;
+        for (auto axis : outer_axes)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+            outer_count *= out_dims[axis];
+        }
+
+        const size_t rows = out_dims[inner];
+        const size_t cols = out_dims[last];
+        const size_t row_tiles = (rows + tile_size - 1) / tile_size;
+        const size_t elements_per_unit = std::min(rows, tile_size) * cols;
+        runtime::parallel_for(
+            outer_count * row_tiles,
+            std::max<size_t>(1, min_elements_per_chunk / elements_per_unit),
+            [&](size_t begin, size_t end) {
+                for (size_t unit = begin; unit < end; ++unit)
                 {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+                    size_t outer = unit / row_tiles;
+                    const size_t row_begin = (unit % row_tiles) * tile_size;
+                    size_t src_offset = row_begin;
+                    size_t dst_offset = row_begin * dst_strides[inner];
+                    for (auto axis = outer_axes.rbegin(); axis != outer_axes.rend(); ++axis)
                     {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                        {
-                            for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
-                            {
-                                // clang-format off
-                                memcpy(out,
-                                       in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[4] * in_shape[5] +
-                                             *map_index[5]) * elem_size,
-                                       elem_size);
-                                out += elem_size;
-                                // clang-format on
-                            }
-                        }
+                        const size_t index = outer % out_dims[*axis];
+                        outer /= out_dims[*axis];
+                        src_offset += index * src_strides[*axis];
+                        dst_offset += index * dst_strides[*axis];
                     }
+                    transpose_block(in + src_offset * elem_size,
+                                    out + dst_offset * elem_size,
+                                    std::min(tile_size, rows - row_begin),
+                                    cols,
+                                    src_strides[last],
+                                    dst_strides[inner],
+                                    elem_size);
                 }
-            }
-        }
-    }
-    bool no_axis_reordering(const AxisVector& axis_order)
-    {
-        auto tmp = axis_order;
-        std::sort(begin(tmp), end(tmp));
-        tmp.erase(std::unique(begin(tmp), end(tmp)), end(tmp));
-        return tmp == axis_order;
+            });
     }
 } // namespace
+
 void runtime::opt_kernel::reshape(const char* in,
                                   char* out,
                                   const Shape& in_shape,
@@ -255,15 +277,24 @@ void runtime::opt_kernel::reshape(const char* in,
         return;
     }
 
-    switch (in_shape.size())
+    NGRAPH_CHECK(in_axis_order.size() == in_shape.size(),
+                 "Axis order ",
+                 in_axis_order,
+                 " doesn't match the shape ",
+                 in_shape);
+
+    if (shape_size(in_shape) == 0)
+    {
+        return;
+    }
+
+    Shape shape;
+    AxisVector axis_order;
+    collapse_axes(in_shape, in_axis_order, shape, axis_order);
+    if (no_axis_reordering(axis_order))
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+        std::memcpy(out, in, shape_size(in_shape) * elem_size);
+        return;
     }
+    transpose(in, out, shape, axis_order, elem_size);
 }
@@ -38,6 +38,7 @@ descriptor::Input::~Input()
 
 void descriptor::Input::replace_output(Output& new_output)
 {
+    m_node->increment_topology_versions();
     if (m_output != nullptr)
     {
         m_output->remove_input(this);
@@ -215,7 +215,10 @@ void Function::prerequirements(bool detect_variables, bool detect_parameters)
 
     const auto& ordered_ops = get_ordered_ops();
     if (detect_parameters)
+    {
         m_parameters = auto_detect_parameters(ordered_ops);
+        invalidate_ordered_ops();
+    }
     else
         check_all_parameters_registered(ordered_ops, m_parameters);
 
@@ -280,6 +283,29 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    const size_t version = m_topology_version->get();
+    if (m_ordered_ops_valid && m_ordered_ops_version == version)
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_ordered_ops.size());
+        for (const auto& op : m_ordered_ops)
+        {
+            auto node = op.lock();
+            // a removed node, its consumer must have incremented the version, sort to be sure
+            if (!node)
+            {
+                ordered_ops.clear();
+                break;
+            }
+            ordered_ops.push_back(std::move(node));
+        }
+        if (!ordered_ops.empty())
+        {
+            return ordered_ops;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -294,7 +320,18 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+
+    m_ordered_ops.clear();
+    m_ordered_ops.reserve(ordered_ops.size());
+    for (const auto& node : ordered_ops)
+    {
+        node->add_topology_version(m_topology_version);
+        m_ordered_ops.push_back(node);
+    }
+    m_ordered_ops_version = version;
+    m_ordered_ops_valid = true;
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -458,11 +495,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_ordered_ops();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_ordered_ops();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -540,12 +579,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_ordered_ops();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_ordered_ops();
     for (const auto& sink : sinks)
     {
         if (const auto& variable_op = dynamic_pointer_cast<VariableExtension>(sink))
@@ -565,11 +606,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_ordered_ops();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -579,6 +622,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_ordered_ops();
 }
 
 void Function::add_parameters(const ParameterVector& params)
@@ -595,6 +639,7 @@ void Function::add_parameters(const ParameterVector& params)
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
@@ -604,6 +649,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
                        m_parameters.end(),
                        [&param](std::shared_ptr<op::v0::Parameter>& r) { return r == param; }),
         m_parameters.end());
+    invalidate_ordered_ops();
 }
 
 void Function::add_variables(const VariableVector& variables)
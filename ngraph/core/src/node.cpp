@@ -46,6 +46,7 @@ Node::Node(const Node& node)
 
 Node& Node::operator=(const Node& node)
 {
+    increment_topology_versions();
     this->m_control_dependents = node.m_control_dependents;
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
@@ -182,6 +183,7 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    increment_topology_versions();
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -192,6 +194,38 @@ void Node::set_arguments(const OutputVector& arguments)
     }
 }
 
+void Node::add_topology_version(const std::shared_ptr<TopologyVersion>& version)
+{
+    // the versions of the destroyed functions are dropped, so the temporary functions built
+    // around the node don't accumulate
+    std::lock_guard<std::mutex> lock(m_topology_versions_mutex);
+    bool registered = false;
+    m_topology_versions.erase(remove_if(m_topology_versions.begin(),
+                                        m_topology_versions.end(),
+                                        [&](const std::weak_ptr<TopologyVersion>& v) {
+                                            auto locked = v.lock();
+                                            registered = registered || locked == version;
+                                            return !locked;
+                                        }),
+                              m_topology_versions.end());
+    if (!registered)
+    {
+        m_topology_versions.push_back(version);
+    }
+}
+
+void Node::increment_topology_versions()
+{
+    std::lock_guard<std::mutex> lock(m_topology_versions_mutex);
+    for (auto& version : m_topology_versions)
+    {
+        if (auto locked = version.lock())
+        {
+            locked->increment();
+        }
+    }
+}
+
 descriptor::Input& Node::get_input_descriptor(size_t position)
 {
     while (m_inputs.size() <= position)
@@ -472,6 +506,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        increment_topology_versions();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -509,6 +544,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
         {
+            increment_topology_versions();
             m_control_dependencies.erase(it);
         }
     }
@@ -531,6 +567,10 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
+    if (!m_control_dependencies.empty())
+    {
+        increment_topology_versions();
+    }
     m_control_dependencies.clear();
 }
 
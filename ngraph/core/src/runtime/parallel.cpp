@@ -0,0 +1,98 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "ngraph/runtime/parallel.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace
+{
+    mutex& executor_mutex()
+    {
+        static mutex m;
+        return m;
+    }
+
+    shared_ptr<runtime::parallel_executor_t>& custom_executor()
+    {
+        static shared_ptr<runtime::parallel_executor_t> executor;
+        return executor;
+    }
+
+    // the loops started by the kernels called from the parallel loop don't add more threads
+    thread_local bool in_parallel_region = false;
+} // namespace
+
+runtime::parallel_executor_t runtime::set_parallel_executor(parallel_executor_t executor)
+{
+    lock_guard<mutex> lock(executor_mutex());
+    auto previous = custom_executor();
+    custom_executor() = executor ? make_shared<parallel_executor_t>(move(executor)) : nullptr;
+    return previous ? *previous : parallel_executor_t{};
+}
+
+void runtime::parallel_for(size_t work_amount,
+                           size_t min_chunk,
+                           const function<void(size_t begin, size_t end)>& body)
+{
+    if (work_amount == 0)
+    {
+        return;
+    }
+    shared_ptr<parallel_executor_t> executor;
+    {
+        lock_guard<mutex> lock(executor_mutex());
+        executor = custom_executor();
+    }
+    const size_t hardware_threads = max<size_t>(1, thread::hardware_concurrency());
+    const size_t chunk = max<size_t>(1, min_chunk);
+    const size_t max_threads = min(hardware_threads, (work_amount + chunk - 1) / chunk);
+    // starting threads per loop costs more than most of the reference kernels, so without an
+    // executor the loop runs sequentially
+    if (!executor || max_threads <= 1 || in_parallel_region)
+    {
+        body(0, work_amount);
+        return;
+    }
+
+    mutex error_mutex;
+    exception_ptr error;
+    auto range_body = [&](size_t ithr, size_t nthr) {
+        // the executor threads may be reused by the application, so the flag is restored
+        const bool was_in_parallel_region = in_parallel_region;
+        in_parallel_region = true;
+        try
+        {
+            const size_t begin = work_amount * ithr / nthr;
+            const size_t end = work_amount * (ithr + 1) / nthr;
+            if (begin < end)
+            {
+                body(begin, end);
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(error_mutex);
+            if (!error)
+            {
+                error = current_exception();
+            }
+        }
+        in_parallel_region = was_in_parallel_region;
+    };
+
+    (*executor)(max_threads, range_body);
+
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
@@ -39,6 +39,22 @@ namespace ngraph
             ONNX_IMPORTER_API
             std::shared_ptr<Function> import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
                                                         const std::string& model_path);
+
+            /// \brief      Imports and converts an ONNX model taking the ownership of the
+            ///             ModelProto, so the Constants created from the initializers share the
+            ///             raw data of the model instead of copying it.
+            ///
+            /// \note       The function can be used only internally by OV components!
+            ///
+            /// \param[in]  model_proto The imported ModelProto.
+            /// \param[in]  model_path  The path to the imported onnx model.
+            ///
+            /// \return     An nGraph function that represents a single output from the created
+            /// graph.
+            ONNX_IMPORTER_API
+            std::shared_ptr<Function>
+                import_onnx_model(std::unique_ptr<ONNX_NAMESPACE::ModelProto>&& model_proto,
+                                  const std::string& model_path);
         } // namespace detail
     }     // namespace onnx_import
 } // namespace ngraph
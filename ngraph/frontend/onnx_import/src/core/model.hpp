@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -36,6 +37,12 @@ namespace ngraph
             Model& operator=(const Model&) = delete;
             Model& operator=(Model&&) = delete;
 
+            /// \brief Returns the model proto, the Constants created from the initializers share
+            ///        its raw data.
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> get_model_proto() const
+            {
+                return m_model_proto;
+            }
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
@@ -71,7 +78,7 @@ namespace ngraph
             void enable_opset_domain(const std::string& domain);
 
         private:
-            const std::unique_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
+            const std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -467,8 +470,14 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param[in]  tensor       The tensor proto.
+            /// \param[in]  model_proto  The model owning the tensor proto. The Constants created
+            ///                          from the tensor share its raw data instead of copying
+            ///                          it and keep the model alive.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
                 : m_tensor_proto{&tensor}
+                , m_model_proto{std::move(model_proto)}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
             {
                 if (m_shape == Shape{0})
@@ -594,8 +603,11 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                auto constant = make_shared_ng_constant<T>(type);
+                if (!constant)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -603,7 +615,58 @@ namespace ngraph
                 return constant;
             }
 
+            /// \brief Creates the Constant over the mapped external data or over the raw data of
+            ///        the model, so the data isn't copied to the heap.
+            ///
+            /// \return The Constant or nullptr if the data has to be converted by get_data().
+            template <typename T>
+            std::shared_ptr<ngraph::op::Constant>
+                make_shared_ng_constant(const element::Type& type) const
+            {
+                const size_t byte_size = shape_size(m_shape) * type.size();
+                if (m_tensor_proto->has_segment() || byte_size == 0)
+                {
+                    return nullptr;
+                }
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    const auto data =
+                        detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data();
+                    if (data->size() != byte_size)
+                    {
+                        return nullptr;
+                    }
+                    if (!is_aligned<T>(data->get_ptr()))
+                    {
+                        // the offset in the file doesn't keep the alignment of the type
+                        return std::make_shared<ngraph::op::Constant>(
+                            type, m_shape, data->get_ptr());
+                    }
+                    return std::make_shared<ngraph::op::Constant>(type, m_shape, data);
+                }
+                if (m_model_proto && m_tensor_proto->has_raw_data() &&
+                    m_tensor_proto->raw_data().size() == byte_size &&
+                    is_aligned<T>(m_tensor_proto->raw_data().data()))
+                {
+                    auto model_proto = m_model_proto;
+                    auto data = std::make_shared<
+                        runtime::SharedBuffer<std::shared_ptr<const ONNX_NAMESPACE::ModelProto>>>(
+                        const_cast<char*>(m_tensor_proto->raw_data().data()),
+                        byte_size,
+                        model_proto);
+                    return std::make_shared<ngraph::op::Constant>(type, m_shape, data);
+                }
+                return nullptr;
+            }
+
+            template <typename T>
+            static bool is_aligned(const void* data)
+            {
+                return reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0;
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
             Shape m_shape;
         };
 
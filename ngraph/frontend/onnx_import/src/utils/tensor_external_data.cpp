@@ -2,7 +2,18 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
-#include <fstream>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cstdint>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -16,6 +27,166 @@ namespace ngraph
     {
         namespace detail
         {
+            /// \brief  Copy-on-write mapping of the range of the file
+            class MappedMemory
+            {
+            public:
+                /// \param[in]  path    The path to the mapped file.
+                /// \param[in]  offset  The offset of the range in the file.
+                /// \param[in]  length  The length of the range, 0 maps the rest of the file.
+                ///
+                /// \note       The range is left unmapped if the file can't be opened or the range
+                ///             exceeds the file, see is_mapped().
+                MappedMemory(const std::string& path, size_t offset, size_t length);
+                ~MappedMemory();
+
+                MappedMemory(const MappedMemory&) = delete;
+                MappedMemory& operator=(const MappedMemory&) = delete;
+
+                bool is_mapped() const { return m_mapped; }
+                char* data() const { return m_data; }
+                size_t size() const { return m_size; }
+
+            private:
+                /// \brief  Maps the [offset, offset + length) range of the open file, the range
+                ///         is extended to the start of the page as the mapped offset has to be
+                ///         aligned to the mapping granularity
+                template <typename MapView>
+                void map(size_t file_size,
+                         size_t offset,
+                         size_t length,
+                         size_t granularity,
+                         MapView map_view)
+                {
+                    if (offset > file_size || (length != 0 && length > file_size - offset))
+                    {
+                        return;
+                    }
+                    m_size = length == 0 ? file_size - offset : length;
+                    if (m_size == 0)
+                    {
+                        m_mapped = true;
+                        return;
+                    }
+                    const size_t view_offset = offset / granularity * granularity;
+                    m_view_size = offset - view_offset + m_size;
+                    m_view = map_view(view_offset, m_view_size);
+                    if (m_view != nullptr)
+                    {
+                        m_data = static_cast<char*>(m_view) + (offset - view_offset);
+                        m_mapped = true;
+                    }
+                }
+
+                void* m_view = nullptr;
+                size_t m_view_size = 0;
+                char* m_data = nullptr;
+                size_t m_size = 0;
+                bool m_mapped = false;
+            };
+
+#ifdef _WIN32
+            MappedMemory::MappedMemory(const std::string& path, size_t offset, size_t length)
+            {
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+                const std::wstring file_path = file_util::multi_byte_char_to_wstring(path.c_str());
+                HANDLE file = CreateFileW(file_path.c_str(),
+                                          GENERIC_READ,
+                                          FILE_SHARE_READ,
+                                          nullptr,
+                                          OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL,
+                                          nullptr);
+#else
+                HANDLE file = CreateFileA(path.c_str(),
+                                          GENERIC_READ,
+                                          FILE_SHARE_READ,
+                                          nullptr,
+                                          OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL,
+                                          nullptr);
+#endif
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return;
+                }
+                LARGE_INTEGER file_size;
+                SYSTEM_INFO system_info;
+                GetSystemInfo(&system_info);
+                if (GetFileSizeEx(file, &file_size))
+                {
+                    map(static_cast<size_t>(file_size.QuadPart),
+                        offset,
+                        length,
+                        system_info.dwAllocationGranularity,
+                        [&](size_t view_offset, size_t view_size) -> void* {
+                            HANDLE mapping = CreateFileMapping(
+                                file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                            if (mapping == nullptr)
+                            {
+                                return nullptr;
+                            }
+                            const auto offset64 = static_cast<uint64_t>(view_offset);
+                            void* view = MapViewOfFile(mapping,
+                                                       FILE_MAP_COPY,
+                                                       static_cast<DWORD>(offset64 >> 32),
+                                                       static_cast<DWORD>(offset64),
+                                                       view_size);
+                            // the view stays valid after the handles are closed
+                            CloseHandle(mapping);
+                            return view;
+                        });
+                }
+                CloseHandle(file);
+            }
+
+            MappedMemory::~MappedMemory()
+            {
+                if (m_view != nullptr)
+                {
+                    UnmapViewOfFile(m_view);
+                }
+            }
+#else
+            MappedMemory::MappedMemory(const std::string& path, size_t offset, size_t length)
+            {
+                const int fd = open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                {
+                    return;
+                }
+                struct stat file_stat = {};
+                if (fstat(fd, &file_stat) == 0)
+                {
+                    map(static_cast<size_t>(file_stat.st_size),
+                        offset,
+                        length,
+                        static_cast<size_t>(sysconf(_SC_PAGESIZE)),
+                        [&](size_t view_offset, size_t view_size) -> void* {
+                            // MAP_PRIVATE mapping shares clean pages with the page cache,
+                            // written pages are copied
+                            void* view = mmap(nullptr,
+                                              view_size,
+                                              PROT_READ | PROT_WRITE,
+                                              MAP_PRIVATE,
+                                              fd,
+                                              static_cast<off_t>(view_offset));
+                            return view == MAP_FAILED ? nullptr : view;
+                        });
+                }
+                // the mapping stays valid after the descriptor is closed
+                close(fd);
+            }
+
+            MappedMemory::~MappedMemory()
+            {
+                if (m_view != nullptr)
+                {
+                    munmap(m_view, m_view_size);
+                }
+            }
+#endif
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -23,9 +194,9 @@ namespace ngraph
                     if (entry.key() == "location")
                         m_data_location = entry.value();
                     if (entry.key() == "offset")
-                        m_offset = std::stoi(entry.value());
+                        m_offset = std::stoull(entry.value());
                     if (entry.key() == "length")
-                        m_data_length = std::stoi(entry.value());
+                        m_data_length = std::stoull(entry.value());
                     if (entry.key() == "checksum")
                         m_sha1_digest = std::stoi(entry.value());
                 }
@@ -33,43 +204,27 @@ namespace ngraph
 
             std::string TensorExternalData::load_external_data() const
             {
-#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring path = file_util::multi_byte_char_to_wstring(m_data_location.c_str());
-#else
-                std::string path = m_data_location;
-#endif
-                std::ifstream external_data_stream(path,
-                                                   std::ios::binary | std::ios::in | std::ios::ate);
-                if (external_data_stream.fail())
-                    throw error::invalid_external_data{*this};
-
-                std::streamsize read_data_length;
-                if (m_data_length == 0) // read entire file
-                    read_data_length = external_data_stream.tellg();
-                else
-                    read_data_length = m_data_length;
-
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
+                const auto mapped_data = load_external_mmap_data();
+                if (mapped_data->size() == 0)
                 {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
+                    return {};
                 }
-                // default value of m_offset is 0
-                external_data_stream.seekg(m_offset, std::ios::beg);
+                return std::string(mapped_data->get_ptr<char>(), mapped_data->size());
+            }
+
+            std::shared_ptr<MappedExternalData> TensorExternalData::load_external_mmap_data() const
+            {
+                auto memory =
+                    std::make_shared<MappedMemory>(m_data_location, m_offset, m_data_length);
+                if (!memory->is_mapped())
+                    throw error::invalid_external_data{*this};
 
                 if (m_sha1_digest != 0)
                 {
                     NGRAPH_WARN << "SHA1 checksum is not supported";
                 }
 
-                std::string read_data;
-                read_data.resize(read_data_length);
-                external_data_stream.read(&read_data[0], read_data_length);
-                external_data_stream.close();
-
-                return read_data;
+                return std::make_shared<MappedExternalData>(memory->data(), memory->size(), memory);
             }
 
             std::string TensorExternalData::to_string() const
@@ -4,14 +4,22 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
     {
         namespace detail
         {
+            class MappedMemory;
+
+            /// \brief  Buffer of the tensor data keeping the external data file mapped
+            using MappedExternalData = runtime::SharedBuffer<std::shared_ptr<MappedMemory>>;
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
@@ -27,6 +35,16 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Map external data from tensor passed to constructor into memory
+                ///
+                /// \note       The file is mapped copy-on-write, so the pages are read by the OS
+                ///             on the first access and the data isn't copied to the heap.
+                ///             If mapping of the external file fails,
+                ///             the invalid_external_data exception is thrown.
+                ///
+                /// \return     Buffer of the tensor data, the file stays mapped while it is used
+                std::shared_ptr<MappedExternalData> load_external_mmap_data() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
@@ -34,8 +52,8 @@ namespace ngraph
 
             private:
                 std::string m_data_location{};
-                int m_offset = 0;
-                int m_data_length = 0;
+                size_t m_offset = 0;
+                size_t m_data_length = 0;
                 int m_sha1_digest = 0;
             };
         } // namespace detail
@@ -0,0 +1,312 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset7.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/validate.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace
+{
+    struct CountingSorter
+    {
+        shared_ptr<size_t> calls = make_shared<size_t>(0);
+
+        Function::topological_sort_t get() const
+        {
+            auto counter = calls;
+            return [counter](const vector<shared_ptr<Node>>& root_nodes) {
+                (*counter)++;
+                return topological_sort(root_nodes);
+            };
+        }
+    };
+
+    bool contains(const NodeVector& nodes, const shared_ptr<Node>& node)
+    {
+        return find(nodes.begin(), nodes.end(), node) != nodes.end();
+    }
+
+    // checks that every node follows its inputs
+    bool is_topologically_sorted(const NodeVector& nodes)
+    {
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            for (const auto& input : nodes[i]->input_values())
+            {
+                auto producer = find(nodes.begin(), nodes.end(), input.get_node_shared_ptr());
+                if (producer == nodes.end() || producer - nodes.begin() > static_cast<ptrdiff_t>(i))
+                    return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+TEST(function_ordered_ops, sorted_once_while_unchanged)
+{
+    auto param = make_shared<opset7::Parameter>(element::f32, Shape{1, 4});
+    auto relu = make_shared<opset7::Relu>(param);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{param});
+    CountingSorter sorter;
+    f->set_topological_sort(sorter.get());
+
+    const auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(ordered_ops, f->get_ordered_ops());
+    EXPECT_EQ(ordered_ops, f->get_ordered_ops());
+    EXPECT_EQ(*sorter.calls, 1);
+    EXPECT_TRUE(is_topologically_sorted(ordered_ops));
+
+    // new nodes don't change the function until they are connected to it
+    auto unused = make_shared<opset7::Sigmoid>(relu);
+    f->get_ordered_ops();
+    EXPECT_EQ(*sorter.calls, 1);
+}
+
+TEST(function_ordered_ops, replace_node)
+{
+    auto param = make_shared<opset7::Parameter>(element::f32, Shape{1, 4});
+    auto relu = make_shared<opset7::Relu>(param);
+    auto abs = make_shared<opset7::Abs>(relu);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{param});
+    CountingSorter sorter;
+    f->set_topological_sort(sorter.get());
+    f->get_ordered_ops();
+
+    auto sigmoid = make_shared<opset7::Sigmoid>(param);
+    replace_node(relu, sigmoid);
+    weak_ptr<Node> replaced = relu;
+    relu.reset();
+    // the function doesn't keep the replaced node alive
+    EXPECT_TRUE(replaced.expired());
+
+    const auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(*sorter.calls, 2);
+    EXPECT_TRUE(contains(ordered_ops, sigmoid));
+    EXPECT_EQ(ordered_ops.size(), 4);
+    EXPECT_TRUE(is_topologically_sorted(ordered_ops));
+}
+
+TEST(function_ordered_ops, input_and_output_changes)
+{
+    auto param = make_shared<opset7::Parameter>(element::f32, Shape{1, 4});
+    auto relu = make_shared<opset7::Relu>(param);
+    auto abs = make_shared<opset7::Abs>(relu);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{param});
+    CountingSorter sorter;
+    f->set_topological_sort(sorter.get());
+    f->get_ordered_ops();
+
+    auto exp = make_shared<opset7::Exp>(relu);
+    abs->input(0).replace_source_output(exp);
+    EXPECT_TRUE(contains(f->get_ordered_ops(), exp));
+    EXPECT_EQ(*sorter.calls, 2);
+
+    auto negative = make_shared<opset7::Negative>(param);
+    relu->output(0).replace(negative);
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_TRUE(contains(ordered_ops, negative));
+    EXPECT_FALSE(contains(ordered_ops, relu));
+    EXPECT_EQ(*sorter.calls, 3);
+
+    auto floor = make_shared<opset7::Floor>(param);
+    exp->set_argument(0, floor);
+    ordered_ops = f->get_ordered_ops();
+    EXPECT_TRUE(contains(ordered_ops, floor));
+    EXPECT_FALSE(contains(ordered_ops, negative));
+    EXPECT_TRUE(is_topologically_sorted(ordered_ops));
+}
+
+TEST(function_ordered_ops, control_dependencies)
+{
+    auto param = make_shared<opset7::Parameter>(element::f32, Shape{1, 4});
+    auto relu = make_shared<opset7::Relu>(param);
+    auto abs = make_shared<opset7::Abs>(param);
+    auto add = make_shared<opset7::Add>(relu, abs);
+    auto f = make_shared<Function>(NodeVector{add}, ParameterVector{param});
+    CountingSorter sorter;
+    f->set_topological_sort(sorter.get());
+    f->get_ordered_ops();
+
+    relu->add_control_dependency(abs);
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(*sorter.calls, 2);
+    EXPECT_LT(find(ordered_ops.begin(), ordered_ops.end(), abs),
+              find(ordered_ops.begin(), ordered_ops.end(), relu));
+
+    relu->remove_control_dependency(abs);
+    f->get_ordered_ops();
+    EXPECT_EQ(*sorter.calls, 3);
+
+    abs->add_control_dependency(relu);
+    f->get_ordered_ops();
+    abs->clear_control_dependencies();
+    f->get_ordered_ops();
+    EXPECT_EQ(*sorter.calls, 5);
+}
+
+TEST(function_ordered_ops, results_sinks_and_parameters)
+{
+    auto param = make_shared<opset7::Parameter>(element::f32, Shape{1, 4});
+    auto relu = make_shared<opset7::Relu>(param);
+    auto result = make_shared<opset7::Result>(relu);
+    auto f = make_shared<Function>(ResultVector{result}, ParameterVector{param});
+    CountingSorter sorter;
+    f->set_topological_sort(sorter.get());
+    f->get_ordered_ops();
+
+    auto extra_param = make_shared<opset7::Parameter>(element::f32, Shape{1, 4});
+    f->add_parameters({extra_param});
+    EXPECT_TRUE(contains(f->get_ordered_ops(), extra_param));
+    f->remove_parameter(extra_param);
+    EXPECT_FALSE(contains(f->get_ordered_ops(), extra_param));
+
+    auto extra_result = make_shared<opset7::Result>(make_shared<opset7::Abs>(param));
+    f->add_results({extra_result});
+    EXPECT_TRUE(contains(f->get_ordered_ops(), extra_result));
+    f->remove_result(extra_result);
+    EXPECT_FALSE(contains(f->get_ordered_ops(), extra_result));
+
+    auto variable = make_shared<Variable>(
+        VariableInfo{PartialShape{1, 4}, element::f32, "variable"});
+    auto read_value = make_shared<opset7::ReadValue>(param, variable);
+    auto assign = make_shared<opset7::Assign>(read_value, variable);
+    f->add_sinks({assign});
+    EXPECT_TRUE(contains(f->get_ordered_ops(), assign));
+    f->remove_sink(assign);
+    EXPECT_FALSE(contains(f->get_ordered_ops(), assign));
+
+    auto new_param = make_shared<opset7::Parameter>(element::f32, Shape{1, 4});
+    f->replace_parameter(0, new_param);
+    EXPECT_TRUE(contains(f->get_ordered_ops(), new_param));
+    EXPECT_EQ(*sorter.calls, 8);
+}
+
+TEST(function_ordered_ops, node_in_several_functions)
+{
+    auto param = make_shared<opset7::Parameter>(element::f32, Shape{1, 4});
+    auto relu = make_shared<opset7::Relu>(param);
+    auto first = make_shared<Function>(NodeVector{relu}, ParameterVector{param});
+    auto second = make_shared<Function>(NodeVector{make_shared<opset7::Abs>(relu)},
+                                        ParameterVector{param});
+    first->get_ordered_ops();
+    second->get_ordered_ops();
+
+    auto sigmoid = make_shared<opset7::Sigmoid>(param);
+    relu->set_argument(0, sigmoid);
+    EXPECT_TRUE(contains(first->get_ordered_ops(), sigmoid));
+    EXPECT_TRUE(contains(second->get_ordered_ops(), sigmoid));
+}
+
+TEST(function_ordered_ops, concurrent_functions_share_nodes)
+{
+    auto param = make_shared<opset7::Parameter>(element::f32, Shape{1, 4});
+    Output<Node> current = param;
+    for (size_t i = 0; i < 100; i++)
+    {
+        current = make_shared<opset7::Relu>(current);
+    }
+    auto result = make_shared<opset7::Result>(current);
+    auto f = make_shared<Function>(ResultVector{result}, ParameterVector{param});
+    const auto expected_size = f->get_ordered_ops().size();
+
+    // every function registers its version in the shared nodes and the destroyed ones are dropped
+    atomic<size_t> mismatches{0};
+    vector<thread> threads;
+    for (size_t t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&]() {
+            for (size_t i = 0; i < 200; i++)
+            {
+                auto g = make_shared<Function>(ResultVector{result}, ParameterVector{param});
+                if (g->get_ordered_ops().size() != expected_size)
+                {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(mismatches, 0);
+
+    auto sigmoid = make_shared<opset7::Sigmoid>(param);
+    result->input(0).get_source_output().get_node()->set_argument(0, sigmoid);
+    EXPECT_TRUE(contains(f->get_ordered_ops(), sigmoid));
+}
+
+namespace
+{
+    // Chain of the blocks of the unrolled transformer-like network, the blocks have no constant
+    // sub-graphs, so the passes don't change the function and only query its nodes
+    shared_ptr<Function> make_long_function(size_t blocks)
+    {
+        auto param = make_shared<opset7::Parameter>(element::f32, Shape{1, 16});
+        Output<Node> current = param;
+        for (size_t i = 0; i < blocks; i++)
+        {
+            auto weights = opset7::Constant::create(element::f32, Shape{16, 16}, {0.01f});
+            auto matmul = make_shared<opset7::MatMul>(current, weights);
+            auto relu = make_shared<opset7::Relu>(matmul);
+            auto add = make_shared<opset7::Add>(relu, current);
+            current = add;
+        }
+        return make_shared<Function>(OutputVector{current}, ParameterVector{param});
+    }
+
+    class SigmoidMatcher : public pass::MatcherPass
+    {
+    public:
+        NGRAPH_RTTI_DECLARATION;
+        SigmoidMatcher()
+        {
+            auto sigmoid = pattern::wrap_type<opset7::Sigmoid>();
+            register_matcher(make_shared<pattern::Matcher>(sigmoid, "SigmoidMatcher"),
+                             [](pattern::Matcher&) { return false; });
+        }
+    };
+
+    NGRAPH_RTTI_DEFINITION(SigmoidMatcher, "SigmoidMatcher", 0);
+} // namespace
+
+// Measures the pass pipeline of the typical load on the large function, each pass queries the
+// ordered nodes and Validate follows every pass. The time is reported as the test property
+TEST(function_ordered_ops, DISABLED_pass_pipeline_benchmark)
+{
+    for (size_t blocks : {1000, 10000, 20000})
+    {
+        auto f = make_long_function(blocks);
+        pass::Manager manager;
+        manager.set_per_pass_validation(true);
+        for (int i = 0; i < 20; i++)
+        {
+            manager.register_pass<pass::ConstantFolding>();
+            manager.register_pass<SigmoidMatcher>();
+        }
+
+        const auto start = chrono::steady_clock::now();
+        manager.run_passes(f);
+        const chrono::duration<double, milli> duration = chrono::steady_clock::now() - start;
+        RecordProperty("nodes_" + to_string(f->get_ops().size()) + "_ms",
+                       to_string(duration.count()));
+    }
+}
@@ -89,6 +89,20 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_offset_not_page_aligned)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_offset_not_page_aligned.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // first input: {2, 3} mapped from the middle of the page, second: {0x02000000} read from
+    // the offset not aligned to the element size
+    test_case.add_input<int32_t>({4});
+
+    test_case.add_expected_output<int32_t>({2, 3, 0x02000000, 4});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try
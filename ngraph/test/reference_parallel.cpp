@@ -0,0 +1,338 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace
+{
+    // runs the ranges on std::thread per range, so the kernels are run in parallel by the tests,
+    // the previous executor is restored on destruction
+    class ThreadedExecutor
+    {
+    public:
+        ThreadedExecutor()
+        {
+            m_previous = runtime::set_parallel_executor(
+                [](size_t max_threads, const function<void(size_t, size_t)>& body) {
+                    vector<thread> threads;
+                    for (size_t ithr = 1; ithr < max_threads; ithr++)
+                    {
+                        threads.emplace_back(body, ithr, max_threads);
+                    }
+                    body(0, max_threads);
+                    for (auto& t : threads)
+                    {
+                        t.join();
+                    }
+                });
+        }
+        ~ThreadedExecutor() { runtime::set_parallel_executor(m_previous); }
+
+    private:
+        runtime::parallel_executor_t m_previous;
+    };
+
+    template <typename T>
+    vector<T> make_data(size_t size, int seed)
+    {
+        mt19937 gen(seed);
+        uniform_int_distribution<int> dist(-8, 8);
+        vector<T> data(size);
+        for (auto& value : data)
+        {
+            value = static_cast<T>(dist(gen)) / 4;
+        }
+        return data;
+    }
+} // namespace
+
+TEST(reference_parallel, parallel_for_covers_range_once)
+{
+    ThreadedExecutor executor;
+    for (size_t work_amount : {1, 7, 1000, 100003})
+    {
+        vector<atomic<int>> visits(work_amount);
+        for (auto& v : visits)
+        {
+            v = 0;
+        }
+        runtime::parallel_for(work_amount, 10, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                visits[i]++;
+            }
+        });
+        EXPECT_TRUE(all_of(visits.begin(), visits.end(), [](const atomic<int>& v) {
+            return v == 1;
+        }));
+    }
+}
+
+TEST(reference_parallel, nested_loops_run_on_calling_thread)
+{
+    ThreadedExecutor executor;
+    atomic<bool> nested_on_other_thread{false};
+    runtime::parallel_for(1000, 1, [&](size_t, size_t) {
+        const auto id = this_thread::get_id();
+        runtime::parallel_for(1000, 1, [&](size_t, size_t) {
+            if (this_thread::get_id() != id)
+            {
+                nested_on_other_thread = true;
+            }
+        });
+    });
+    EXPECT_FALSE(nested_on_other_thread);
+}
+
+TEST(reference_parallel, exception_is_rethrown)
+{
+    ThreadedExecutor executor;
+    EXPECT_THROW(runtime::parallel_for(1000,
+                                       1,
+                                       [](size_t begin, size_t) {
+                                           if (begin == 0)
+                                           {
+                                               throw runtime_error("range failed");
+                                           }
+                                       }),
+                 runtime_error);
+}
+
+TEST(reference_parallel, without_executor_runs_on_calling_thread)
+{
+    const auto previous = runtime::set_parallel_executor(nullptr);
+    const auto id = this_thread::get_id();
+    size_t calls = 0;
+    runtime::parallel_for(100000, 1, [&](size_t begin, size_t end) {
+        EXPECT_EQ(id, this_thread::get_id());
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 100000);
+        calls++;
+    });
+    runtime::set_parallel_executor(previous);
+
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(reference_parallel, custom_executor)
+{
+    atomic<size_t> calls{0};
+    const auto previous = runtime::set_parallel_executor(
+        [&](size_t max_threads, const function<void(size_t, size_t)>& body) {
+            calls++;
+            // fewer threads than requested
+            const size_t nthr = max<size_t>(1, max_threads / 2);
+            for (size_t ithr = 0; ithr < nthr; ithr++)
+            {
+                body(ithr, nthr);
+            }
+        });
+    size_t covered = 0;
+    runtime::parallel_for(1000, 1, [&](size_t begin, size_t end) { covered += end - begin; });
+    // the previous executor is returned when the executor is replaced
+    EXPECT_TRUE(static_cast<bool>(runtime::set_parallel_executor(previous)));
+
+    EXPECT_EQ(covered, 1000);
+    EXPECT_EQ(calls, thread::hardware_concurrency() > 1 ? 1 : 0);
+}
+
+TEST(reference_parallel, transpose_matches_reference)
+{
+    mt19937 gen(7);
+    const vector<Shape> shapes{{256, 384},
+                               {2, 64, 56, 56},
+                               {1, 3, 1, 224, 224},
+                               {4, 1, 16, 9, 32, 2},
+                               {3, 5, 7, 2, 3, 2, 2}};
+    for (const auto& shape : shapes)
+    {
+        for (size_t elem_size : {1, 2, 3, 4, 8})
+        {
+            vector<char> input(shape_size(shape) * elem_size);
+            iota(input.begin(), input.end(), 0);
+            AxisVector order(shape.size());
+            iota(order.begin(), order.end(), 0);
+            for (int attempt = 0; attempt < 4; attempt++)
+            {
+                shuffle(order.begin(), order.end(), gen);
+                Shape out_shape;
+                for (auto axis : order)
+                {
+                    out_shape.push_back(shape[axis]);
+                }
+
+                vector<char> expected(input.size());
+                vector<char> actual(input.size());
+                runtime::reference::reshape(
+                    input.data(), expected.data(), shape, order, out_shape, elem_size);
+                runtime::opt_kernel::reshape(
+                    input.data(), actual.data(), shape, order, out_shape, elem_size);
+                ASSERT_EQ(expected, actual) << "shape " << shape << ", order " << order
+                                            << ", element size " << elem_size;
+            }
+        }
+    }
+}
+
+TEST(reference_parallel, matmul_matches_sequential)
+{
+    const Shape arg0_shape{3, 1, 67, 129};
+    const Shape arg1_shape{4, 129, 95};
+    const Shape out_shape{3, 4, 67, 95};
+    const auto arg0 = make_data<float>(shape_size(arg0_shape), 1);
+    const auto arg1 = make_data<float>(shape_size(arg1_shape), 2);
+
+    vector<float> parallel(shape_size(out_shape));
+    {
+        ThreadedExecutor executor;
+        runtime::reference::matmul(arg0.data(),
+                                   arg1.data(),
+                                   parallel.data(),
+                                   arg0_shape,
+                                   arg1_shape,
+                                   out_shape,
+                                   false,
+                                   false);
+    }
+
+    vector<float> sequential(shape_size(out_shape));
+    runtime::reference::matmul(
+        arg0.data(), arg1.data(), sequential.data(), arg0_shape, arg1_shape, out_shape, false, false);
+    EXPECT_EQ(parallel, sequential);
+
+    // the first row of the first batch
+    for (size_t j = 0; j < out_shape[3]; j++)
+    {
+        float expected = 0;
+        for (size_t k = 0; k < arg0_shape[3]; k++)
+        {
+            expected += arg0[k] * arg1[k * out_shape[3] + j];
+        }
+        EXPECT_FLOAT_EQ(parallel[j], expected);
+    }
+}
+
+TEST(reference_parallel, convolution_matches_sequential)
+{
+    const Shape in_shape{2, 8, 30, 30};
+    const Shape f_shape{16, 8, 3, 3};
+    const Shape out_shape{2, 16, 15, 15};
+    const auto in = make_data<float>(shape_size(in_shape), 3);
+    const auto f = make_data<float>(shape_size(f_shape), 4);
+    const Strides strides{2, 2};
+    const Strides dilations{1, 1};
+    const CoordinateDiff pads_begin{1, 1};
+    const CoordinateDiff pads_end{0, 0};
+
+    vector<float> parallel(shape_size(out_shape));
+    {
+        ThreadedExecutor executor;
+        runtime::reference::convolution(in.data(),
+                                        f.data(),
+                                        parallel.data(),
+                                        in_shape,
+                                        f_shape,
+                                        out_shape,
+                                        strides,
+                                        dilations,
+                                        pads_begin,
+                                        pads_end);
+    }
+
+    vector<float> sequential(shape_size(out_shape));
+    runtime::reference::convolution(in.data(),
+                                    f.data(),
+                                    sequential.data(),
+                                    in_shape,
+                                    f_shape,
+                                    out_shape,
+                                    strides,
+                                    dilations,
+                                    pads_begin,
+                                    pads_end);
+    EXPECT_EQ(parallel, sequential);
+}
+
+TEST(reference_parallel, broadcast_binop_matches_coordinate_transform)
+{
+    // per-channel broadcasts of the weights and the broadcasts of both arguments
+    const vector<pair<Shape, Shape>> shapes{{{64, 32, 3, 3}, {64, 1, 1, 1}},
+                                            {{1, 32, 3, 3}, {64, 1, 1, 1}},
+                                            {{8, 1, 96, 1}, {1, 16, 1, 80}},
+                                            {{128, 1024}, {1024}},
+                                            {{300, 300}, {}}};
+    for (const auto& p : shapes)
+    {
+        const auto out_shape = [&] {
+            Shape shape = p.first;
+            Shape other = p.second;
+            while (other.size() < shape.size())
+                other.insert(other.begin(), 1);
+            while (shape.size() < other.size())
+                shape.insert(shape.begin(), 1);
+            for (size_t i = 0; i < shape.size(); i++)
+                shape[i] = max(shape[i], other[i]);
+            return shape;
+        }();
+        const auto arg0 = make_data<float>(shape_size(p.first), 5);
+        const auto arg1 = make_data<float>(shape_size(p.second), 6);
+
+        vector<float> actual(shape_size(out_shape));
+        ThreadedExecutor executor;
+        runtime::reference::add(arg0.data(),
+                                arg1.data(),
+                                actual.data(),
+                                p.first,
+                                p.second,
+                                op::AutoBroadcastSpec::NUMPY);
+
+        vector<float> expected(shape_size(out_shape));
+        const size_t rank = out_shape.size();
+        const Shape arg0_padded = [&] {
+            Shape s = p.first;
+            s.insert(s.begin(), rank - s.size(), 1);
+            return s;
+        }();
+        const Shape arg1_padded = [&] {
+            Shape s = p.second;
+            s.insert(s.begin(), rank - s.size(), 1);
+            return s;
+        }();
+        CoordinateTransformBasic arg0_transform(arg0_padded);
+        CoordinateTransformBasic arg1_transform(arg1_padded);
+        CoordinateTransformBasic out_transform(out_shape);
+        size_t out_index = 0;
+        for (const auto& coord : out_transform)
+        {
+            Coordinate c0(coord), c1(coord);
+            for (size_t i = 0; i < rank; i++)
+            {
+                c0[i] = arg0_padded[i] == 1 ? 0 : coord[i];
+                c1[i] = arg1_padded[i] == 1 ? 0 : coord[i];
+            }
+            expected[out_index++] =
+                arg0[arg0_transform.index(c0)] + arg1[arg1_transform.index(c1)];
+        }
+        EXPECT_EQ(expected, actual) << p.first << " + " << p.second;
+    }
+}